@@ -2,6 +2,8 @@
 #define BENCHMARK_CONTAINER_BENCHMARKS_HPP
 
 #include <cassert>
+#include <cstdio>
+#include <vector>
 
 #include "benchmark/benchmark_api.h"
 
@@ -16,10 +18,37 @@ void BM_ConstructIterIter(benchmark::State& st, Container, GenInputs gen) {
     benchmark::DoNotOptimize(&in);
     while (st.KeepRunning()) {
         Container c(begin, end);
+        benchmark::DoNotOptimize(c);
+    }
+}
+
+template <class Container, class GenInputs>
+void BM_PushBack(benchmark::State& st, Container, GenInputs gen) {
+    auto in = gen(st.range(0));
+    const auto end = in.end();
+    benchmark::DoNotOptimize(&in);
+    while (st.KeepRunning()) {
+        Container c;
+        for (auto it = in.begin(); it != end; ++it)
+            c.push_back(*it);
         benchmark::DoNotOptimize(c.data());
     }
 }
 
+template <class Container, class GenInputs>
+void BM_InsertEraseMiddle(benchmark::State& st, Container, GenInputs gen) {
+    auto in = gen(st.range(0));
+    Container c(in.begin(), in.end());
+    const auto value = in.front();
+    const auto mid = c.size() / 2;
+    benchmark::DoNotOptimize(&c);
+    while (st.KeepRunning()) {
+        c.insert(c.begin() + mid, value);
+        c.erase(c.begin() + mid);
+        benchmark::ClobberMemory();
+    }
+}
+
 template <class Container, class GenInputs>
 void BM_InsertValue(benchmark::State& st, Container c, GenInputs gen) {
     auto in = gen(st.range(0));
@@ -108,6 +137,33 @@ static void BM_FindRehash(benchmark::State& st, Container c, GenInputs gen) {
     }
 }
 
+// Fills a fresh container from a file of st.range(0) bytes, as code that
+// reads whole files does.  With default_init the buffer is grown with the
+// __resize_default_init extension, so it is not zeroed before the read.
+// Other standard libraries lack it and always use resize.
+template <class Container>
+static void BM_ReadFile(benchmark::State& st, Container, bool default_init) {
+    const std::size_t size = st.range(0);
+    std::FILE* f = std::tmpfile();
+    assert(f);
+    std::vector<char> contents(size, 'x');
+    std::fwrite(contents.data(), 1, size, f);
+    while (st.KeepRunning()) {
+        std::rewind(f);
+        Container c;
+#ifdef _LIBCPP_VERSION
+        if (default_init)
+            c.__resize_default_init(size);
+        else
+#endif
+            c.resize(size);
+        benchmark::DoNotOptimize(std::fread(&c[0], 1, size, f));
+        benchmark::ClobberMemory();
+    }
+    st.SetBytesProcessed(st.iterations() * size);
+    std::fclose(f);
+}
+
 } // end namespace ContainerBenchmarks
 
 #endif // BENCHMARK_CONTAINER_BENCHMARKS_HPP
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <random>
 #include <unordered_set>
 #include <vector>
 #include <cstdint>
@@ -58,5 +60,42 @@ BENCHMARK_CAPTURE(BM_Sort, sorted_descending_strings,
 BENCHMARK_CAPTURE(BM_Sort, single_element_strings,
     getDuplicateStringInputs)->Arg(TestNumInputs);
 
+template <class Engine>
+void BM_Shuffle(benchmark::State& st, Engine g) {
+    std::vector<uint32_t> v = getRandomIntegerInputs<uint32_t>(st.range(0));
+    while (st.KeepRunning()) {
+        std::shuffle(v.begin(), v.end(), g);
+        benchmark::DoNotOptimize(v.data());
+    }
+    st.SetItemsProcessed(st.iterations() * v.size());
+}
+
+BENCHMARK_CAPTURE(BM_Shuffle, mt19937,
+    std::mt19937())->Arg(TestNumInputs)->Arg(1 << 20);
+
+BENCHMARK_CAPTURE(BM_Shuffle, mt19937_64,
+    std::mt19937_64())->Arg(TestNumInputs)->Arg(1 << 20);
+
+BENCHMARK_CAPTURE(BM_Shuffle, minstd_rand,
+    std::minstd_rand())->Arg(TestNumInputs)->Arg(1 << 20);
+
+template <class Engine>
+void BM_UniformInt(benchmark::State& st, Engine g) {
+    std::uniform_int_distribution<uint32_t> d(0, st.range(0) - 1);
+    std::vector<uint32_t> out(TestNumInputs);
+    while (st.KeepRunning()) {
+        for (auto& x : out)
+            x = d(g);
+        benchmark::DoNotOptimize(out.data());
+    }
+    st.SetItemsProcessed(st.iterations() * out.size());
+}
+
+BENCHMARK_CAPTURE(BM_UniformInt, mt19937,
+    std::mt19937())->Arg(6)->Arg(1000)->Arg(3 << 29);
+
+BENCHMARK_CAPTURE(BM_UniformInt, mt19937_64,
+    std::mt19937_64())->Arg(6)->Arg(1000)->Arg(3 << 29);
+
 
 BENCHMARK_MAIN()
@@ -0,0 +1,125 @@
+#include <bitset>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <cstddef>
+
+#include "benchmark/benchmark_api.h"
+
+// Roughly half the bits set, in no pattern a branch predictor would learn.
+static bool randomBit(std::size_t i) {
+  unsigned x = static_cast<unsigned>(i) * 2654435761u;
+  return ((x ^ (x >> 15)) * 2246822519u) >> 31;
+}
+
+template <std::size_t N>
+static std::bitset<N> makeBitset() {
+  std::bitset<N> b;
+  for (std::size_t i = 0; i < N; ++i)
+    b[i] = randomBit(i);
+  return b;
+}
+
+static std::vector<bool> makeVector(std::size_t n, std::size_t salt) {
+  std::vector<bool> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = randomBit(i + salt);
+  return v;
+}
+
+template <std::size_t N>
+static void BM_BitsetToString(benchmark::State& st) {
+  const std::bitset<N> b = makeBitset<N>();
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(b.to_string());
+  st.SetItemsProcessed(st.iterations() * N);
+}
+BENCHMARK_TEMPLATE(BM_BitsetToString, 64);
+BENCHMARK_TEMPLATE(BM_BitsetToString, 4096);
+
+template <std::size_t N>
+static void BM_BitsetFromString(benchmark::State& st) {
+  const std::string s = makeBitset<N>().to_string();
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(std::bitset<N>(s));
+  st.SetItemsProcessed(st.iterations() * N);
+}
+BENCHMARK_TEMPLATE(BM_BitsetFromString, 64);
+BENCHMARK_TEMPLATE(BM_BitsetFromString, 4096);
+
+template <std::size_t N>
+static void BM_BitsetCount(benchmark::State& st) {
+  const std::bitset<N> b = makeBitset<N>();
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(b.count());
+  st.SetItemsProcessed(st.iterations() * N);
+}
+BENCHMARK_TEMPLATE(BM_BitsetCount, 4096);
+
+// Visits every set bit, with st.range(0) bits in 4096 set.
+static void BM_BitsetFindNext(benchmark::State& st) {
+  std::bitset<4096> b;
+  for (std::size_t i = 0; i < 4096; i += 4096 / st.range(0))
+    b.set(i);
+  while (st.KeepRunning()) {
+    std::size_t sum = 0;
+    for (std::size_t i = b._Find_first(); i < b.size(); i = b._Find_next(i))
+      sum += i;
+    benchmark::DoNotOptimize(sum);
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK(BM_BitsetFindNext)->Arg(16)->Arg(4096);
+
+// The same walk with operator[], for comparison.
+static void BM_BitsetScan(benchmark::State& st) {
+  std::bitset<4096> b;
+  for (std::size_t i = 0; i < 4096; i += 4096 / st.range(0))
+    b.set(i);
+  while (st.KeepRunning()) {
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < b.size(); ++i)
+      if (b[i])
+        sum += i;
+    benchmark::DoNotOptimize(sum);
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK(BM_BitsetScan)->Arg(16)->Arg(4096);
+
+// Intersects two masks of st.range(0) bits, with the output offset by
+// st.range(1) bits.
+static void BM_VectorBoolAnd(benchmark::State& st) {
+  const std::size_t n = st.range(0);
+  const std::size_t off = st.range(1);
+  const std::vector<bool> a = makeVector(n, 0);
+  const std::vector<bool> b = makeVector(n, 1);
+  std::vector<bool> r(n + off);
+  while (st.KeepRunning()) {
+    std::transform(a.begin(), a.end(), b.begin(), r.begin() + off,
+                   std::logical_and<bool>());
+    benchmark::ClobberMemory();
+  }
+  st.SetItemsProcessed(st.iterations() * n);
+}
+BENCHMARK(BM_VectorBoolAnd)->Args({1 << 16, 0})->Args({1 << 16, 5});
+
+static void BM_VectorBoolEqual(benchmark::State& st) {
+  const std::vector<bool> a = makeVector(st.range(0), 0);
+  const std::vector<bool> b = a;
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(a == b);
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK(BM_VectorBoolEqual)->Arg(1 << 16);
+
+static void BM_VectorBoolCount(benchmark::State& st) {
+  const std::vector<bool> a = makeVector(st.range(0), 0);
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(std::count(a.begin(), a.end(), true));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK(BM_VectorBoolCount)->Arg(1 << 16);
+
+BENCHMARK_MAIN()
@@ -0,0 +1,133 @@
+#include <codecvt>
+#include <locale>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstddef>
+
+#include "benchmark/benchmark_api.h"
+
+enum Corpus { Ascii, MixedBMP, Emoji };
+
+static void appendUTF8(std::string &s, unsigned long c) {
+  if (c < 0x80) {
+    s += static_cast<char>(c);
+  } else if (c < 0x800) {
+    s += static_cast<char>(0xC0 | (c >> 6));
+    s += static_cast<char>(0x80 | (c & 0x3F));
+  } else if (c < 0x10000) {
+    s += static_cast<char>(0xE0 | (c >> 12));
+    s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    s += static_cast<char>(0x80 | (c & 0x3F));
+  } else {
+    s += static_cast<char>(0xF0 | (c >> 18));
+    s += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+    s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    s += static_cast<char>(0x80 | (c & 0x3F));
+  }
+}
+
+// About Len bytes of UTF-8 in words of one to ten letters.  MixedBMP puts an
+// accented Latin or a CJK character after each word, Emoji an astral one.
+static std::string makeCorpus(Corpus c, std::size_t Len) {
+  std::mt19937 gen(4);
+  std::uniform_int_distribution<int> wordLen(1, 10), letter('a', 'z');
+  std::string s;
+  while (s.size() < Len) {
+    for (int n = wordLen(gen); n > 0; --n)
+      s += static_cast<char>(letter(gen));
+    s += ' ';
+    if (c == MixedBMP)
+      appendUTF8(s, gen() % 3 ? 0xE0 + gen() % 32 : 0x4E00 + gen() % 0x5000);
+    else if (c == Emoji)
+      appendUTF8(s, 0x1F600 + gen() % 64);
+  }
+  return s;
+}
+
+template <class Facet>
+static void BM_DecodeUTF8(benchmark::State &state, Corpus c) {
+  typedef typename Facet::intern_type CharT;
+  Facet f;
+  std::string in = makeCorpus(c, state.range(0));
+  std::vector<CharT> out(in.size());
+  while (state.KeepRunning()) {
+    std::mbstate_t st = std::mbstate_t();
+    const char *frm_nxt;
+    CharT *to_nxt;
+    f.in(st, in.data(), in.data() + in.size(), frm_nxt,
+         out.data(), out.data() + out.size(), to_nxt);
+    benchmark::DoNotOptimize(to_nxt);
+  }
+  state.SetBytesProcessed(state.iterations() * in.size());
+}
+
+template <class Facet>
+static void BM_EncodeUTF8(benchmark::State &state, Corpus c) {
+  typedef typename Facet::intern_type CharT;
+  Facet f;
+  std::string utf8 = makeCorpus(c, state.range(0));
+  std::vector<CharT> in(utf8.size());
+  {
+    std::mbstate_t st = std::mbstate_t();
+    const char *frm_nxt;
+    CharT *to_nxt;
+    f.in(st, utf8.data(), utf8.data() + utf8.size(), frm_nxt,
+         in.data(), in.data() + in.size(), to_nxt);
+    in.resize(to_nxt - in.data());
+  }
+  std::string out(utf8.size(), '\0');
+  while (state.KeepRunning()) {
+    std::mbstate_t st = std::mbstate_t();
+    const CharT *frm_nxt;
+    char *to_nxt;
+    f.out(st, in.data(), in.data() + in.size(), frm_nxt,
+          &out[0], &out[0] + out.size(), to_nxt);
+    benchmark::DoNotOptimize(to_nxt);
+  }
+  state.SetBytesProcessed(state.iterations() * utf8.size());
+}
+
+template <class Facet>
+static void BM_LengthUTF8(benchmark::State &state, Corpus c) {
+  Facet f;
+  std::string in = makeCorpus(c, state.range(0));
+  while (state.KeepRunning()) {
+    std::mbstate_t st = std::mbstate_t();
+    benchmark::DoNotOptimize(
+        f.length(st, in.data(), in.data() + in.size(), in.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * in.size());
+}
+
+typedef std::codecvt_utf8_utf16<char16_t> UTF8_UTF16;
+typedef std::codecvt_utf8<char32_t> UTF8_UCS4;
+
+static void BM_DecodeUTF16(benchmark::State &state, Corpus c) {
+  BM_DecodeUTF8<UTF8_UTF16>(state, c);
+}
+static void BM_DecodeUCS4(benchmark::State &state, Corpus c) {
+  BM_DecodeUTF8<UTF8_UCS4>(state, c);
+}
+static void BM_EncodeUTF16(benchmark::State &state, Corpus c) {
+  BM_EncodeUTF8<UTF8_UTF16>(state, c);
+}
+static void BM_EncodeUCS4(benchmark::State &state, Corpus c) {
+  BM_EncodeUTF8<UTF8_UCS4>(state, c);
+}
+static void BM_LengthUTF16(benchmark::State &state, Corpus c) {
+  BM_LengthUTF8<UTF8_UTF16>(state, c);
+}
+
+#define CODECVT_BENCHMARK(Name)                                               \
+  BENCHMARK_CAPTURE(Name, ascii, Ascii)->Range(64, 1 << 20);                  \
+  BENCHMARK_CAPTURE(Name, mixed_bmp, MixedBMP)->Range(64, 1 << 20);           \
+  BENCHMARK_CAPTURE(Name, emoji, Emoji)->Range(64, 1 << 20)
+
+CODECVT_BENCHMARK(BM_DecodeUTF16);
+CODECVT_BENCHMARK(BM_DecodeUCS4);
+CODECVT_BENCHMARK(BM_EncodeUTF16);
+CODECVT_BENCHMARK(BM_EncodeUCS4);
+CODECVT_BENCHMARK(BM_LengthUTF16);
+
+BENCHMARK_MAIN()
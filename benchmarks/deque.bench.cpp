@@ -0,0 +1,103 @@
+#include <deque>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+#include "benchmark/benchmark_api.h"
+
+#include "ContainerBenchmarks.hpp"
+#include "GenerateInput.hpp"
+
+using namespace ContainerBenchmarks;
+
+constexpr std::size_t TestNumInputs = 1024;
+constexpr std::size_t MaxDequeLen = 1 << 18;
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+  deque_char,
+  std::deque<char>{},
+  getRandomIntegerInputs<char>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+  deque_size_t,
+  std::deque<size_t>{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+  deque_string,
+  std::deque<std::string>{},
+  getRandomStringInputs)->Arg(TestNumInputs);
+
+// A queue that stays at a fixed length: push at the back, pop at the front.
+template <class T>
+static void BM_DequeQueue(benchmark::State& state) {
+  std::deque<T> d(state.range(0));
+  while (state.KeepRunning()) {
+    d.push_back(T());
+    d.pop_front();
+    benchmark::DoNotOptimize(&d.front());
+  }
+}
+BENCHMARK_TEMPLATE(BM_DequeQueue, int)->Range(16, MaxDequeLen);
+
+struct Large {
+  char c[512];
+};
+BENCHMARK_TEMPLATE(BM_DequeQueue, Large)->Range(16, MaxDequeLen / 64);
+
+// The same element in 32 KB blocks instead of the default 8 KB.
+struct LargeBigBlocks {
+  char c[512];
+};
+namespace std {
+template <>
+struct __libcpp_deque_block_size<LargeBigBlocks> : integral_constant<size_t, 64> {};
+}
+BENCHMARK_TEMPLATE(BM_DequeQueue, LargeBigBlocks)->Range(16, MaxDequeLen / 64);
+
+// Algorithms over a whole deque, which run a block at a time.
+template <class T>
+static void BM_DequeFill(benchmark::State& state) {
+  std::deque<T> d(state.range(0));
+  while (state.KeepRunning()) {
+    std::fill(d.begin(), d.end(), T(1));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * d.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_DequeFill, char)->Range(16, MaxDequeLen);
+BENCHMARK_TEMPLATE(BM_DequeFill, int)->Range(16, MaxDequeLen);
+
+template <class T>
+static void BM_DequeFind(benchmark::State& state) {
+  std::deque<T> d(state.range(0));
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(std::find(d.begin(), d.end(), T(1)));
+  state.SetBytesProcessed(state.iterations() * d.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_DequeFind, char)->Range(16, MaxDequeLen);
+BENCHMARK_TEMPLATE(BM_DequeFind, int)->Range(16, MaxDequeLen);
+
+static void BM_DequeForEach(benchmark::State& state) {
+  std::deque<int> d(state.range(0), 1);
+  while (state.KeepRunning()) {
+    long sum = 0;
+    std::for_each(d.begin(), d.end(), [&sum](int i) { sum += i; });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * d.size() * sizeof(int));
+}
+BENCHMARK(BM_DequeForEach)->Range(16, MaxDequeLen);
+
+static void BM_DequeCopyToVector(benchmark::State& state) {
+  std::deque<int> d(state.range(0), 1);
+  std::vector<int> v(d.size());
+  while (state.KeepRunning()) {
+    std::copy(d.begin(), d.end(), v.begin());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * d.size() * sizeof(int));
+}
+BENCHMARK(BM_DequeCopyToVector)->Range(16, MaxDequeLen);
+
+BENCHMARK_MAIN()
@@ -0,0 +1,42 @@
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+// Distributions that sample through normal_distribution or
+// exponential_distribution.  distributions_ziggurat.bench.cpp runs the same
+// benchmarks with _LIBCPP_ENABLE_ZIGGURAT_DISTRIBUTIONS.
+template <class Dist, class Engine>
+static void BM_Distribution(benchmark::State& st, Dist d, Engine g) {
+  std::vector<typename Dist::result_type> out(st.range(0));
+  while (st.KeepRunning()) {
+    for (auto& x : out)
+      x = d(g);
+    benchmark::DoNotOptimize(out.data());
+  }
+  st.SetItemsProcessed(st.iterations() * out.size());
+}
+
+BENCHMARK_CAPTURE(BM_Distribution, normal_double_mt19937,
+                  std::normal_distribution<double>(),
+                  std::mt19937())->Arg(1 << 14);
+BENCHMARK_CAPTURE(BM_Distribution, normal_double_mt19937_64,
+                  std::normal_distribution<double>(),
+                  std::mt19937_64())->Arg(1 << 14);
+BENCHMARK_CAPTURE(BM_Distribution, normal_float_mt19937,
+                  std::normal_distribution<float>(),
+                  std::mt19937())->Arg(1 << 14);
+BENCHMARK_CAPTURE(BM_Distribution, exponential_double_mt19937,
+                  std::exponential_distribution<double>(),
+                  std::mt19937())->Arg(1 << 14);
+BENCHMARK_CAPTURE(BM_Distribution, exponential_float_mt19937,
+                  std::exponential_distribution<float>(),
+                  std::mt19937())->Arg(1 << 14);
+BENCHMARK_CAPTURE(BM_Distribution, gamma_double_mt19937,
+                  std::gamma_distribution<double>(2.5),
+                  std::mt19937())->Arg(1 << 14);
+BENCHMARK_CAPTURE(BM_Distribution, lognormal_double_mt19937,
+                  std::lognormal_distribution<double>(),
+                  std::mt19937())->Arg(1 << 14);
+
+BENCHMARK_MAIN()
@@ -0,0 +1,2 @@
+#define _LIBCPP_ENABLE_ZIGGURAT_DISTRIBUTIONS
+#include "distributions.bench.cpp"
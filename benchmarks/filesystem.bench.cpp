@@ -1,4 +1,6 @@
 #include <experimental/filesystem>
+#include <fstream>
+#include <string>
 
 #include "benchmark/benchmark_api.h"
 #include "GenerateInput.hpp"
@@ -135,4 +137,180 @@ void BM_PathIterateOnceBackwards(benchmark::State &st, GenInputs gen) {
 BENCHMARK_CAPTURE(BM_PathIterateOnceBackwards, iterate_elements,
   getRandomStringInputs)->Arg(TestNumInputs);
 
+template <class GenInputs>
+void BM_PathCompareEqual(benchmark::State &st, GenInputs gen) {
+  using namespace fs;
+  const auto in = gen(st.range(0));
+  path PP;
+  for (auto& Part : in)
+    PP /= Part;
+  const path P2 = PP;
+  benchmark::DoNotOptimize(PP.native().data());
+  benchmark::DoNotOptimize(P2.native().data());
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(PP.compare(P2));
+  }
+}
+BENCHMARK_CAPTURE(BM_PathCompareEqual, large_string,
+  getRandomStringInputs)->Arg(TestNumInputs);
+
+template <class GenInputs>
+void BM_PathCompareLastElement(benchmark::State &st, GenInputs gen) {
+  using namespace fs;
+  const auto in = gen(st.range(0));
+  path PP;
+  for (auto& Part : in)
+    PP /= Part;
+  const path P2 = PP.parent_path() / "x";
+  benchmark::DoNotOptimize(PP.native().data());
+  benchmark::DoNotOptimize(P2.native().data());
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(PP.compare(P2));
+  }
+}
+BENCHMARK_CAPTURE(BM_PathCompareLastElement, large_string,
+  getRandomStringInputs)->Arg(TestNumInputs);
+
+template <class GenInputs>
+void BM_PathDecompose(benchmark::State &st, GenInputs gen) {
+  using namespace fs;
+  const auto in = gen(st.range(0));
+  path PP;
+  for (auto& Part : in)
+    PP /= Part;
+  PP += ".txt";
+  benchmark::DoNotOptimize(PP.native().data());
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(PP.filename().native().data());
+    benchmark::DoNotOptimize(PP.parent_path().native().data());
+    benchmark::DoNotOptimize(PP.extension().native().data());
+  }
+}
+BENCHMARK_CAPTURE(BM_PathDecompose, large_string,
+  getRandomStringInputs)->Arg(TestNumInputs);
+
+// Makes a tree of empty files under Root, FilesPerDir of them in every
+// directory.  Each of the Width directories at the top holds a chain of
+// Depth nested directories.
+static void makeFileTree(const fs::path& Root, std::size_t Width,
+                         std::size_t Depth, std::size_t FilesPerDir) {
+  using namespace fs;
+  for (std::size_t W = 0; W < Width; ++W) {
+    path Dir = Root / std::to_string(W);
+    for (std::size_t D = 0; D < Depth; ++D, Dir /= "d") {
+      create_directories(Dir);
+      for (std::size_t F = 0; F < FilesPerDir; ++F)
+        std::ofstream((Dir / std::to_string(F)).c_str());
+    }
+  }
+}
+
+static fs::path getRandomTempPath() {
+  return fs::temp_directory_path() /
+      ("libcxx_bench_tree." + std::to_string(getRandomInteger<unsigned>()));
+}
+
+// A tree under temp_directory_path() that is made once and removed at exit.
+// Point TMPDIR at a tmpfs to leave the disk out of the measurements.
+struct FileTree {
+  fs::path Root;
+
+  FileTree(std::size_t Width, std::size_t Depth, std::size_t FilesPerDir)
+      : Root(getRandomTempPath()) {
+    makeFileTree(Root, Width, Depth, FilesPerDir);
+  }
+  ~FileTree() { fs::remove_all(Root); }
+};
+
+// 10^5 files in 1000 directories one level down.
+static const fs::path& getWideTree() {
+  static const FileTree Tree(1000, 1, 100);
+  return Tree.Root;
+}
+
+// 10^5 files in 1000 directories, in chains 100 deep.
+static const fs::path& getDeepTree() {
+  static const FileTree Tree(10, 100, 100);
+  return Tree.Root;
+}
+
+template <class GetTree>
+void BM_RecursiveWalk(benchmark::State &st, GetTree getTree) {
+  using namespace fs;
+  const path& Root = getTree();
+  std::size_t Files = 0;
+  while (st.KeepRunning()) {
+    Files = 0;
+    for (const directory_entry& E : recursive_directory_iterator(Root))
+      Files += !E.is_directory();
+    benchmark::DoNotOptimize(Files);
+  }
+  st.SetItemsProcessed(st.iterations() * Files);
+}
+BENCHMARK_CAPTURE(BM_RecursiveWalk, wide_tree, getWideTree);
+BENCHMARK_CAPTURE(BM_RecursiveWalk, deep_tree, getDeepTree);
+
+// The same walk, asking through status() as before directory_entry kept the
+// file type.
+template <class GetTree>
+void BM_RecursiveWalkStatus(benchmark::State &st, GetTree getTree) {
+  using namespace fs;
+  const path& Root = getTree();
+  std::size_t Files = 0;
+  while (st.KeepRunning()) {
+    Files = 0;
+    for (const directory_entry& E : recursive_directory_iterator(Root))
+      Files += !is_directory(E.status());
+    benchmark::DoNotOptimize(Files);
+  }
+  st.SetItemsProcessed(st.iterations() * Files);
+}
+BENCHMARK_CAPTURE(BM_RecursiveWalkStatus, wide_tree, getWideTree);
+
+static void removeAllSequential(const fs::path& P) { fs::remove_all(P); }
+static void removeAllParallel(const fs::path& P) { fs::parallel_remove_all(P); }
+
+// Removes a tree like getWideTree() but with st.range(0) files.
+template <class RemoveAll>
+void BM_RemoveAll(benchmark::State &st, RemoveAll removeAll) {
+  using namespace fs;
+  const std::size_t Files = st.range(0);
+  while (st.KeepRunning()) {
+    st.PauseTiming();
+    const path Root = getRandomTempPath();
+    makeFileTree(Root, Files / 100, 1, 100);
+    st.ResumeTiming();
+    removeAll(Root);
+  }
+  st.SetItemsProcessed(st.iterations() * Files);
+}
+BENCHMARK_CAPTURE(BM_RemoveAll, sequential, removeAllSequential)
+    ->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RemoveAll, parallel, removeAllParallel)
+    ->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void copySequential(const fs::path& From, const fs::path& To) {
+  fs::copy(From, To, fs::copy_options::recursive);
+}
+static void copyParallel(const fs::path& From, const fs::path& To) {
+  fs::parallel_copy(From, To, fs::copy_options::recursive);
+}
+
+template <class GetTree, class Copy>
+void BM_CopyTree(benchmark::State &st, GetTree getTree, Copy copy) {
+  using namespace fs;
+  const path& Root = getTree();
+  while (st.KeepRunning()) {
+    const path To = getRandomTempPath();
+    copy(Root, To);
+    st.PauseTiming();
+    remove_all(To);
+    st.ResumeTiming();
+  }
+}
+BENCHMARK_CAPTURE(BM_CopyTree, wide_tree_sequential, getWideTree,
+                  copySequential)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CopyTree, wide_tree_parallel, getWideTree,
+                  copyParallel)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN()
@@ -0,0 +1,90 @@
+#include <list>
+#include <forward_list>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include <cstdint>
+
+#include "benchmark/benchmark_api.h"
+
+#include "ContainerBenchmarks.hpp"
+#include "GenerateInput.hpp"
+
+#ifdef _LIBCPP_VERSION
+#include <ext/slab_allocator>
+#endif
+
+using namespace ContainerBenchmarks;
+
+constexpr std::size_t TestNumInputs = 1024;
+constexpr std::size_t MaxListLen = 1 << 20;
+
+template <class Container>
+static void BM_ConstructSizeValue(benchmark::State& st, Container) {
+  const std::size_t size = st.range(0);
+  while (st.KeepRunning()) {
+    Container c(size, 42);
+    benchmark::DoNotOptimize(&c.front());
+  }
+}
+
+// Builds the list one push_back at a time while unrelated allocations come
+// and go, as in a long-running program, then measures a full traversal.
+template <class Container>
+static void BM_IterateScattered(benchmark::State& st, Container c) {
+  const std::size_t size = st.range(0);
+  std::vector<std::unique_ptr<char[]> > other(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    c.push_back(i);
+    other[i].reset(new char[16 + i % 64]);
+    if (i % 3 == 0)
+      other[i / 2].reset();
+  }
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(std::accumulate(c.begin(), c.end(), std::size_t(0)));
+  st.SetItemsProcessed(st.iterations() * size);
+}
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+  list_size_t,
+  std::list<size_t>{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+  forward_list_size_t,
+  std::forward_list<size_t>{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ConstructSizeValue,
+  list_size_t,
+  std::list<size_t>{})->Range(1 << 10, MaxListLen);
+
+BENCHMARK_CAPTURE(BM_IterateScattered,
+  list_size_t,
+  std::list<size_t>{})->Range(1 << 10, MaxListLen);
+
+#ifdef _LIBCPP_VERSION
+using SlabList = std::list<size_t, __gnu_cxx::slab_allocator<size_t> >;
+using SlabForwardList =
+    std::forward_list<size_t, __gnu_cxx::slab_allocator<size_t> >;
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+  list_size_t_slab,
+  SlabList{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+  forward_list_size_t_slab,
+  SlabForwardList{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ConstructSizeValue,
+  list_size_t_slab,
+  SlabList{})->Range(1 << 10, MaxListLen);
+
+BENCHMARK_CAPTURE(BM_IterateScattered,
+  list_size_t_slab,
+  SlabList{})->Range(1 << 10, MaxListLen);
+#endif
+
+BENCHMARK_MAIN()
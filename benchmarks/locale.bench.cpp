@@ -0,0 +1,114 @@
+#include <locale>
+#include <string>
+#include <cstddef>
+
+#include "benchmark/benchmark_api.h"
+#include "GenerateInput.hpp"
+
+typedef std::ctype<char> CType;
+
+static const CType& classicCType() {
+  return std::use_facet<CType>(std::locale::classic());
+}
+
+// Mixed-case text with spaces between words, like an HTTP header or body.
+static std::string getTextInput(std::size_t Len) {
+  std::string s = getRandomString(Len);
+  for (std::size_t i = 7; i < Len; i += 8)
+    s[i] = ' ';
+  return s;
+}
+
+static void BM_CTypeToUpper(benchmark::State &state) {
+  const CType &ct = classicCType();
+  std::string s = getTextInput(state.range(0));
+  while (state.KeepRunning()) {
+    ct.toupper(&s[0], s.data() + s.size());
+    benchmark::DoNotOptimize(s.data());
+    ct.tolower(&s[0], s.data() + s.size());
+    benchmark::DoNotOptimize(s.data());
+  }
+  state.SetBytesProcessed(state.iterations() * s.size() * 2);
+}
+BENCHMARK(BM_CTypeToUpper)->Range(16, 64 << 10);
+
+static void BM_CTypeScanIs(benchmark::State &state) {
+  const CType &ct = classicCType();
+  std::string s = getRandomString(state.range(0));
+  s.back() = ' ';
+  const char *low = s.data();
+  const char *high = low + s.size();
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(ct.scan_is(CType::space, low, high));
+  state.SetBytesProcessed(state.iterations() * s.size());
+}
+BENCHMARK(BM_CTypeScanIs)->Range(16, 64 << 10);
+
+static void BM_CTypeScanNot(benchmark::State &state) {
+  const CType &ct = classicCType();
+  std::string s = getRandomString(state.range(0));
+  s.back() = '-';
+  const char *low = s.data();
+  const char *high = low + s.size();
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(ct.scan_not(CType::alnum, low, high));
+  state.SetBytesProcessed(state.iterations() * s.size());
+}
+BENCHMARK(BM_CTypeScanNot)->Range(16, 64 << 10);
+
+static void BM_CTypeIsRange(benchmark::State &state) {
+  const CType &ct = classicCType();
+  std::string s = getTextInput(state.range(0));
+  std::basic_string<CType::mask> masks(s.size(), 0);
+  while (state.KeepRunning()) {
+    ct.is(s.data(), s.data() + s.size(), &masks[0]);
+    benchmark::DoNotOptimize(masks.data());
+  }
+  state.SetBytesProcessed(state.iterations() * s.size());
+}
+BENCHMARK(BM_CTypeIsRange)->Range(16, 64 << 10);
+
+namespace {
+struct TestFacet : std::locale::facet {
+  static std::locale::id id;
+};
+std::locale::id TestFacet::id;
+} // namespace
+
+static void BM_LocaleCopy(benchmark::State &state) {
+  const std::locale loc = std::locale::classic();
+  while (state.KeepRunning()) {
+    std::locale copy(loc);
+    benchmark::DoNotOptimize(&copy);
+  }
+}
+BENCHMARK(BM_LocaleCopy)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_LocaleConstructNamed(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    std::locale loc("C");
+    benchmark::DoNotOptimize(&loc);
+  }
+}
+BENCHMARK(BM_LocaleConstructNamed);
+
+static void BM_LocaleCombineFacet(benchmark::State &state) {
+  const std::locale base = std::locale::classic();
+  while (state.KeepRunning()) {
+    std::locale loc(base, new TestFacet);
+    benchmark::DoNotOptimize(&loc);
+  }
+}
+BENCHMARK(BM_LocaleCombineFacet)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_LocaleCombineCategory(benchmark::State &state) {
+  const std::locale base = std::locale::classic();
+  const std::locale other(base, new TestFacet);
+  while (state.KeepRunning()) {
+    std::locale loc(base, other, std::locale::numeric);
+    benchmark::DoNotOptimize(&loc);
+  }
+}
+BENCHMARK(BM_LocaleCombineCategory)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN()
@@ -0,0 +1,145 @@
+#include <map>
+#include <set>
+#include <numeric>
+#include <cstdint>
+
+#include "benchmark/benchmark_api.h"
+
+#include "ContainerBenchmarks.hpp"
+#include "GenerateInput.hpp"
+
+#ifdef _LIBCPP_VERSION
+#include <ext/btree_map>
+#include <ext/btree_set>
+#endif
+
+using namespace ContainerBenchmarks;
+
+constexpr std::size_t TestNumInputs = 1024;
+constexpr std::size_t MaxSetLen = 1 << 20;
+
+template <class Container, class GenInputs>
+static void BM_Iterate(benchmark::State& st, Container c, GenInputs gen) {
+  auto in = gen(st.range(0));
+  c.insert(in.begin(), in.end());
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(std::accumulate(c.begin(), c.end(), std::uint64_t(0)));
+  st.SetItemsProcessed(st.iterations() * c.size());
+}
+
+template <class Container, class GenInputs>
+static void BM_EraseValue(benchmark::State& st, Container c, GenInputs gen) {
+  auto in = gen(st.range(0));
+  while (st.KeepRunning()) {
+    st.PauseTiming();
+    c.insert(in.begin(), in.end());
+    st.ResumeTiming();
+    for (auto it = in.begin(); it != in.end(); ++it)
+      benchmark::DoNotOptimize(c.erase(*it));
+  }
+}
+
+// The element by element construction that map(first, last) used to do.
+template <class Container, class GenInputs>
+static void BM_InsertHinted(benchmark::State& st, Container, GenInputs gen) {
+  auto in = gen(st.range(0));
+  while (st.KeepRunning()) {
+    Container c;
+    for (auto it = in.begin(); it != in.end(); ++it)
+      c.insert(c.end(), *it);
+    benchmark::DoNotOptimize(&c);
+  }
+}
+
+template <class Container, class GenInputs>
+static void BM_MapSubscript(benchmark::State& st, Container c, GenInputs gen) {
+  auto in = gen(st.range(0));
+  while (st.KeepRunning()) {
+    c.clear();
+    for (auto it = in.begin(); it != in.end(); ++it)
+      ++c[*it];
+    benchmark::DoNotOptimize(&c);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    set_random_uint32,
+    std::set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    set_sorted_uint32,
+    std::set<uint32_t>{},
+    getSortedIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    set_random_uint32,
+    std::set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Range(TestNumInputs, MaxSetLen);
+
+BENCHMARK_CAPTURE(BM_Iterate,
+    set_random_uint32,
+    std::set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Range(TestNumInputs, MaxSetLen);
+
+BENCHMARK_CAPTURE(BM_EraseValue,
+    set_random_uint32,
+    std::set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+    set_sorted_uint32,
+    std::set<uint32_t>{},
+    getSortedIntegerInputs<uint32_t>)->Range(TestNumInputs, MaxSetLen);
+
+BENCHMARK_CAPTURE(BM_InsertHinted,
+    set_sorted_uint32,
+    std::set<uint32_t>{},
+    getSortedIntegerInputs<uint32_t>)->Range(TestNumInputs, MaxSetLen);
+
+BENCHMARK_CAPTURE(BM_ConstructIterIter,
+    set_random_uint32,
+    std::set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_MapSubscript,
+    map_random_uint32,
+    std::map<uint32_t, uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+#ifdef _LIBCPP_VERSION
+using BtreeSet = __gnu_cxx::btree_set<uint32_t>;
+using BtreeMap = __gnu_cxx::btree_map<uint32_t, uint32_t>;
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    btree_set_random_uint32,
+    BtreeSet{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    btree_set_sorted_uint32,
+    BtreeSet{},
+    getSortedIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    btree_set_random_uint32,
+    BtreeSet{},
+    getRandomIntegerInputs<uint32_t>)->Range(TestNumInputs, MaxSetLen);
+
+BENCHMARK_CAPTURE(BM_Iterate,
+    btree_set_random_uint32,
+    BtreeSet{},
+    getRandomIntegerInputs<uint32_t>)->Range(TestNumInputs, MaxSetLen);
+
+BENCHMARK_CAPTURE(BM_EraseValue,
+    btree_set_random_uint32,
+    BtreeSet{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_MapSubscript,
+    btree_map_random_uint32,
+    BtreeMap{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+#endif
+
+BENCHMARK_MAIN()
@@ -0,0 +1,111 @@
+#include <random>
+#include <vector>
+#include <cstdint>
+
+#include "benchmark/benchmark_api.h"
+
+// One result at a time, as most code uses random_device.
+static void BM_RandomDevice(benchmark::State& st) {
+  std::random_device rd;
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(rd());
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK(BM_RandomDevice);
+
+// Seeding the whole state of an mt19937 through a seed_seq of 624 words
+// taken one by one from a random_device.
+static void BM_SeedMt19937SeedSeq(benchmark::State& st) {
+  std::random_device rd;
+  std::vector<std::uint32_t> words(std::mt19937::state_size);
+  while (st.KeepRunning()) {
+    for (auto& w : words)
+      w = rd();
+    std::seed_seq seq(words.begin(), words.end());
+    std::mt19937 gen(seq);
+    benchmark::DoNotOptimize(gen());
+  }
+}
+BENCHMARK(BM_SeedMt19937SeedSeq);
+
+// Fills an array one operator() call at a time.
+template <class Engine>
+static void BM_EngineCall(benchmark::State& st, Engine g) {
+  std::vector<typename Engine::result_type> out(st.range(0));
+  while (st.KeepRunning()) {
+    for (auto& x : out)
+      x = g();
+    benchmark::DoNotOptimize(out.data());
+  }
+  st.SetItemsProcessed(st.iterations() * out.size());
+}
+BENCHMARK_CAPTURE(BM_EngineCall, mt19937, std::mt19937())->Arg(1 << 16);
+BENCHMARK_CAPTURE(BM_EngineCall, mt19937_64, std::mt19937_64())->Arg(1 << 16);
+
+template <class Dist>
+static void BM_DistributionCall(benchmark::State& st, Dist d) {
+  std::mt19937 g;
+  std::vector<typename Dist::result_type> out(st.range(0));
+  while (st.KeepRunning()) {
+    for (auto& x : out)
+      x = d(g);
+    benchmark::DoNotOptimize(out.data());
+  }
+  st.SetItemsProcessed(st.iterations() * out.size());
+}
+BENCHMARK_CAPTURE(BM_DistributionCall, uniform_real_double,
+                  std::uniform_real_distribution<double>())->Arg(1 << 16);
+BENCHMARK_CAPTURE(BM_DistributionCall, normal_double,
+                  std::normal_distribution<double>())->Arg(1 << 16);
+
+#ifdef _LIBCPP_VERSION
+static void BM_RandomDeviceGenerate(benchmark::State& st) {
+  std::random_device rd;
+  std::vector<unsigned> out(st.range(0));
+  while (st.KeepRunning()) {
+    rd.generate(out.begin(), out.end());
+    benchmark::DoNotOptimize(out.data());
+  }
+  st.SetItemsProcessed(st.iterations() * out.size());
+}
+BENCHMARK(BM_RandomDeviceGenerate)->Range(16, 1 << 16);
+
+static void BM_SeedMt19937Generate(benchmark::State& st) {
+  std::random_device rd;
+  while (st.KeepRunning()) {
+    std::mt19937 gen(rd);
+    benchmark::DoNotOptimize(gen());
+  }
+}
+BENCHMARK(BM_SeedMt19937Generate);
+
+// The same arrays filled through the generate() extension.
+template <class Engine>
+static void BM_EngineGenerate(benchmark::State& st, Engine g) {
+  std::vector<typename Engine::result_type> out(st.range(0));
+  while (st.KeepRunning()) {
+    g.generate(out.begin(), out.end());
+    benchmark::DoNotOptimize(out.data());
+  }
+  st.SetItemsProcessed(st.iterations() * out.size());
+}
+BENCHMARK_CAPTURE(BM_EngineGenerate, mt19937, std::mt19937())->Arg(1 << 16);
+BENCHMARK_CAPTURE(BM_EngineGenerate, mt19937_64, std::mt19937_64())->Arg(1 << 16);
+
+template <class Dist>
+static void BM_DistributionGenerate(benchmark::State& st, Dist d) {
+  std::mt19937 g;
+  std::vector<typename Dist::result_type> out(st.range(0));
+  while (st.KeepRunning()) {
+    d.generate(out.begin(), out.end(), g);
+    benchmark::DoNotOptimize(out.data());
+  }
+  st.SetItemsProcessed(st.iterations() * out.size());
+}
+BENCHMARK_CAPTURE(BM_DistributionGenerate, uniform_real_double,
+                  std::uniform_real_distribution<double>())->Arg(1 << 16);
+BENCHMARK_CAPTURE(BM_DistributionGenerate, normal_double,
+                  std::normal_distribution<double>())->Arg(1 << 16);
+#endif
+
+BENCHMARK_MAIN()
@@ -0,0 +1,122 @@
+#include <regex>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdio>
+
+#include "benchmark/benchmark_api.h"
+#include "GenerateInput.hpp"
+#include "count_new.hpp"
+
+// Report the number of operator new calls made per benchmark iteration.
+static void setAllocationLabel(benchmark::State &state, int NewCalls) {
+  char buf[64];
+  std::snprintf(buf, sizeof(buf), "allocs/iter=%.1f",
+                double(NewCalls) / state.iterations());
+  state.SetLabel(buf);
+}
+
+// A log of random lines with one "ERROR: <n>" line every `MatchEvery` lines.
+static std::string makeLog(std::size_t Size, std::size_t MatchEvery) {
+  std::string log;
+  log.reserve(Size + 128);
+  for (std::size_t line = 0; log.size() < Size; ++line) {
+    if (MatchEvery && line % MatchEvery == MatchEvery - 1)
+      log += "ERROR: 1234\n";
+    else
+      log += "INFO: " + getRandomString(58) + "\n";
+  }
+  return log;
+}
+
+static void BM_RegexSearchLiteralPrefix(benchmark::State &state) {
+  const std::string log = makeLog(state.range(0), 10000);
+  const std::regex re("ERROR: ([0-9]+)");
+  while (state.KeepRunning()) {
+    std::size_t count = 0;
+    for (std::sregex_iterator it(log.begin(), log.end(), re), end; it != end;
+         ++it)
+      ++count;
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetBytesProcessed(state.iterations() * log.size());
+}
+BENCHMARK(BM_RegexSearchLiteralPrefix)->Range(1 << 20, 8 << 20);
+
+static void BM_RegexSearchLiteralNoMatch(benchmark::State &state) {
+  const std::string log = makeLog(state.range(0), 0);
+  const std::regex re("ERROR: ([0-9]+)");
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(std::regex_search(log, re));
+  state.SetBytesProcessed(state.iterations() * log.size());
+}
+BENCHMARK(BM_RegexSearchLiteralNoMatch)->Range(1 << 20, 8 << 20);
+
+// No literal prefix, but matches can only begin with 'E'.
+static void BM_RegexSearchNoPrefix(benchmark::State &state) {
+  const std::string log = makeLog(state.range(0), 10000);
+  const std::regex re("[E]RROR: ([0-9]+)");
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(std::regex_search(log, re));
+  state.SetBytesProcessed(state.iterations() * log.size());
+}
+BENCHMARK(BM_RegexSearchNoPrefix)->Arg(1 << 20);
+
+// Matches begin with one of three letters, which make up about one in twenty
+// characters of the random lines.
+static void BM_RegexSearchFirstChars(benchmark::State &state) {
+  const std::string log = makeLog(state.range(0), 10000);
+  const std::regex re("(ERROR|FATAL|PANIC): ([0-9]+)");
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(std::regex_search(log, re));
+  state.SetBytesProcessed(state.iterations() * log.size());
+}
+BENCHMARK(BM_RegexSearchFirstChars)->Arg(1 << 20);
+
+// Search each line separately, the way a log filter would.  Most lines do not
+// contain a match, so the matcher runs at every position of every line.
+static void BM_RegexSearchPerLine(benchmark::State &state) {
+  std::vector<std::string> lines;
+  for (int i = 0; i < 1000; ++i)
+    lines.push_back("key=" + getRandomString(state.range(0)) +
+                    (i % 100 == 0 ? " id=42" : ""));
+  const std::regex re("[a-z]+=([0-9]+)");
+  std::smatch m;
+  const int NewCalls = globalMemCounter.new_called;
+  while (state.KeepRunning()) {
+    for (const auto &line : lines)
+      benchmark::DoNotOptimize(std::regex_search(line, m, re));
+  }
+  setAllocationLabel(state, globalMemCounter.new_called - NewCalls);
+}
+BENCHMARK(BM_RegexSearchPerLine)->Arg(16)->Arg(64)->Arg(256);
+
+// Build a regex and use it once on a short line, the way code that builds
+// its patterns on the fly would.
+static void BM_RegexConstructAndSearch(benchmark::State &state) {
+  const std::string line = "key=" + getRandomString(32) + " id=42";
+  while (state.KeepRunning()) {
+    const std::regex re("[a-z]+=([0-9]+)");
+    benchmark::DoNotOptimize(std::regex_search(line, re));
+  }
+}
+BENCHMARK(BM_RegexConstructAndSearch);
+
+static void BM_RegexIterate(benchmark::State &state) {
+  std::string text;
+  for (int i = 0; i < state.range(0); ++i)
+    text += "k" + std::to_string(i) + "=" + std::to_string(i * 7) + " ";
+  const std::regex re("([a-z0-9]+)=([0-9]+)");
+  const int NewCalls = globalMemCounter.new_called;
+  while (state.KeepRunning()) {
+    std::size_t count = 0;
+    for (std::sregex_iterator it(text.begin(), text.end(), re), end; it != end;
+         ++it)
+      ++count;
+    benchmark::DoNotOptimize(count);
+  }
+  setAllocationLabel(state, globalMemCounter.new_called - NewCalls);
+}
+BENCHMARK(BM_RegexIterate)->Arg(1000);
+
+BENCHMARK_MAIN()
@@ -0,0 +1,51 @@
+#include <sstream>
+#include <string>
+#include <cstdint>
+
+#include "benchmark/benchmark_api.h"
+#include "GenerateInput.hpp"
+
+// Every stream in every thread shares the global locale, so anything that
+// touches its reference count per operation shows up as contention here.
+
+static void BM_OStringStreamInt(benchmark::State &state) {
+  std::ostringstream ss;
+  int i = 0;
+  while (state.KeepRunning()) {
+    ss.str(std::string());
+    for (int j = 0; j < 64; ++j)
+      ss << i++ << ' ';
+    benchmark::DoNotOptimize(ss.str().data());
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_OStringStreamInt)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_OStringStreamDouble(benchmark::State &state) {
+  std::ostringstream ss;
+  double d = 0.5;
+  while (state.KeepRunning()) {
+    ss.str(std::string());
+    for (int j = 0; j < 64; ++j)
+      ss << (d += 1.25) << ' ';
+    benchmark::DoNotOptimize(ss.str().data());
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_OStringStreamDouble)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_IStringStreamInt(benchmark::State &state) {
+  std::string input;
+  for (int j = 0; j < 64; ++j)
+    input += std::to_string(getRandomInteger<std::uint32_t>()) + " ";
+  while (state.KeepRunning()) {
+    std::istringstream ss(input);
+    unsigned v;
+    while (ss >> v)
+      benchmark::DoNotOptimize(v);
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_IStringStreamInt)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN()
@@ -3,6 +3,7 @@
 #include <cstdint>
 
 #include "benchmark/benchmark_api.h"
+#include "ContainerBenchmarks.hpp"
 #include "GenerateInput.hpp"
 
 constexpr std::size_t MAX_STRING_LEN = 8 << 14;
@@ -46,4 +47,124 @@ static void BM_StringFindMatch2(benchmark::State &state) {
 }
 BENCHMARK(BM_StringFindMatch2)->Range(1, MAX_STRING_LEN / 4);
 
+// Benchmark repetitive text where every position is a candidate that only
+// fails near the end of the needle, as in logs with long common prefixes.
+static void BM_StringFindPathological(benchmark::State &state) {
+  std::string s1(MAX_STRING_LEN, 'a');
+  std::string s2 = std::string(state.range(0), 'a') + 'b' +
+                   std::string(state.range(0), 'a');
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find(s2));
+  state.SetBytesProcessed(state.iterations() * s1.size());
+}
+BENCHMARK(BM_StringFindPathological)->Range(1, 1 << 10);
+
+// Benchmark a long needle in random text that only matches at the end.
+static void BM_StringFindLongNeedle(benchmark::State &state) {
+  std::string s1 = getRandomString(MAX_STRING_LEN);
+  std::string s2 = getRandomString(state.range(0));
+  s1 += s2;
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find(s2));
+  state.SetBytesProcessed(state.iterations() * s1.size());
+}
+BENCHMARK(BM_StringFindLongNeedle)->Range(16, 1 << 12);
+
+// Tokenizer-style scans: find the next separator in a run of word characters,
+// and skip a run of separators.
+static const char Separators[] = " \t\r\n,;";
+
+static void BM_StringFindFirstOf(benchmark::State &state) {
+  std::string s1(state.range(0), 'x');
+  s1 += ';';
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find_first_of(Separators));
+  state.SetBytesProcessed(state.iterations() * s1.size());
+}
+BENCHMARK(BM_StringFindFirstOf)->Range(8, MAX_STRING_LEN);
+
+static void BM_StringFindFirstNotOf(benchmark::State &state) {
+  std::string s1(state.range(0), ' ');
+  s1 += 'x';
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find_first_not_of(Separators));
+  state.SetBytesProcessed(state.iterations() * s1.size());
+}
+BENCHMARK(BM_StringFindFirstNotOf)->Range(8, MAX_STRING_LEN);
+
+static void BM_StringFindLastOf(benchmark::State &state) {
+  std::string s1 = ";" + std::string(state.range(0), 'x');
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find_last_of(Separators));
+  state.SetBytesProcessed(state.iterations() * s1.size());
+}
+BENCHMARK(BM_StringFindLastOf)->Range(8, MAX_STRING_LEN);
+
+// Splits a line of words into fields the way a tokenizer loop would.
+static void BM_StringTokenize(benchmark::State &state) {
+  std::string line;
+  while (line.size() < static_cast<std::size_t>(state.range(0)))
+    line += getRandomString(1 + line.size() % 11) + Separators[line.size() % 6];
+  while (state.KeepRunning()) {
+    std::size_t fields = 0;
+    std::size_t pos = line.find_first_not_of(Separators);
+    while (pos != std::string::npos) {
+      std::size_t end = line.find_first_of(Separators, pos);
+      ++fields;
+      pos = line.find_first_not_of(Separators, end);
+    }
+    benchmark::DoNotOptimize(fields);
+  }
+  state.SetBytesProcessed(state.iterations() * line.size());
+}
+BENCHMARK(BM_StringTokenize)->Range(64, MAX_STRING_LEN);
+
+// Short strings on either side of the inline capacity: 22 chars by default,
+// 46 with _LIBCPP_ABI_LARGE_STRING_SSO.
+static void BM_StringCtorCStr(benchmark::State &state) {
+  std::string src = getRandomString(state.range(0));
+  const char *s = src.c_str();
+  benchmark::DoNotOptimize(s);
+  while (state.KeepRunning()) {
+    std::string str(s);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(BM_StringCtorCStr)->DenseRange(8, 64, 8);
+
+static void BM_StringCopy(benchmark::State &state) {
+  std::string src = getRandomString(state.range(0));
+  while (state.KeepRunning()) {
+    std::string str(src);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(BM_StringCopy)->DenseRange(8, 64, 8);
+
+// Builds a string of the given length a few characters at a time, as
+// formatting and serialization code does.
+static void BM_StringAppend(benchmark::State &state) {
+  const std::size_t len = state.range(0);
+  while (state.KeepRunning()) {
+    std::string str;
+    while (str.size() < len)
+      str.append("abcde", 5);
+    benchmark::DoNotOptimize(str.data());
+  }
+  state.SetBytesProcessed(state.iterations() * len);
+}
+BENCHMARK(BM_StringAppend)->DenseRange(8, 64, 8)->Range(128, MAX_STRING_LEN);
+
+using ContainerBenchmarks::BM_ReadFile;
+
+BENCHMARK_CAPTURE(BM_ReadFile,
+  string_resize,
+  std::string{},
+  false)->Range(1 << 12, 1 << 24);
+
+BENCHMARK_CAPTURE(BM_ReadFile,
+  string_default_init,
+  std::string{},
+  true)->Range(1 << 12, 1 << 24);
+
 BENCHMARK_MAIN()
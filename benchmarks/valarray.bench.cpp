@@ -0,0 +1,151 @@
+#include <valarray>
+#include <cmath>
+#include <cstddef>
+
+#include "benchmark/benchmark_api.h"
+
+// BLAS level 1 style operations on valarrays of st.range(0) elements.
+
+template <class T>
+static std::valarray<T> makeInput(std::size_t n) {
+  std::valarray<T> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = static_cast<T>((i * 37) % 101) + T(1);
+  return v;
+}
+
+template <class T>
+static void BM_Axpy(benchmark::State& st) {
+  const std::valarray<T> x = makeInput<T>(st.range(0));
+  std::valarray<T> y = makeInput<T>(st.range(0));
+  const T a = T(3);
+  while (st.KeepRunning()) {
+    y = a * x + y;
+    benchmark::DoNotOptimize(&y[0]);
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Axpy, float)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Axpy, double)->Arg(1 << 12)->Arg(1 << 20);
+
+template <class T>
+static void BM_AxpyCompound(benchmark::State& st) {
+  const std::valarray<T> x = makeInput<T>(st.range(0));
+  std::valarray<T> y = makeInput<T>(st.range(0));
+  const T a = T(3);
+  while (st.KeepRunning()) {
+    y += a * x;
+    benchmark::DoNotOptimize(&y[0]);
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_AxpyCompound, double)->Arg(1 << 12);
+
+template <class T>
+static void BM_Scal(benchmark::State& st) {
+  std::valarray<T> x = makeInput<T>(st.range(0));
+  while (st.KeepRunning()) {
+    x *= T(1);
+    benchmark::DoNotOptimize(&x[0]);
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Scal, double)->Arg(1 << 12);
+
+template <class T>
+static void BM_Dot(benchmark::State& st) {
+  const std::valarray<T> x = makeInput<T>(st.range(0));
+  const std::valarray<T> y = makeInput<T>(st.range(0));
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize((x * y).sum());
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Dot, float)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Dot, double)->Arg(1 << 12);
+
+template <class T>
+static void BM_Sum(benchmark::State& st) {
+  const std::valarray<T> x = makeInput<T>(st.range(0));
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(x.sum());
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Sum, int)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Sum, double)->Arg(1 << 12);
+
+template <class T>
+static void BM_Min(benchmark::State& st) {
+  const std::valarray<T> x = makeInput<T>(st.range(0));
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(x.min());
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Min, int)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Min, double)->Arg(1 << 12);
+
+template <class T>
+static void BM_Max(benchmark::State& st) {
+  const std::valarray<T> x = makeInput<T>(st.range(0));
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(x.max());
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Max, int)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Max, double)->Arg(1 << 12);
+
+// The two norm, sqrt((x * x).sum()).
+template <class T>
+static void BM_Nrm2(benchmark::State& st) {
+  const std::valarray<T> x = makeInput<T>(st.range(0));
+  while (st.KeepRunning())
+    benchmark::DoNotOptimize(std::sqrt((x * x).sum()));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Nrm2, double)->Arg(1 << 12);
+
+template <class T>
+static void BM_Sqrt(benchmark::State& st) {
+  const std::valarray<T> x = makeInput<T>(st.range(0));
+  std::valarray<T> y(st.range(0));
+  while (st.KeepRunning()) {
+    y = std::sqrt(x);
+    benchmark::DoNotOptimize(&y[0]);
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Sqrt, double)->Arg(1 << 12);
+
+// Every second element, through a slice and a two dimensional gslice.
+template <class T>
+static void BM_SliceCopy(benchmark::State& st) {
+  const std::size_t n = st.range(0);
+  const std::valarray<T> x = makeInput<T>(n);
+  std::valarray<T> y(n);
+  while (st.KeepRunning()) {
+    y[std::slice(0, n / 2, 2)] = x[std::slice(1, n / 2, 2)];
+    benchmark::DoNotOptimize(&y[0]);
+  }
+  st.SetItemsProcessed(st.iterations() * (n / 2));
+}
+BENCHMARK_TEMPLATE(BM_SliceCopy, double)->Arg(1 << 12);
+
+template <class T>
+static void BM_GsliceAxpy(benchmark::State& st) {
+  const std::size_t n = st.range(0);
+  const std::valarray<T> x = makeInput<T>(n);
+  std::valarray<T> y(n);
+  std::valarray<std::size_t> len(2), stride(2);
+  len[0] = n / 64;
+  len[1] = 32;
+  stride[0] = 64;
+  stride[1] = 2;
+  const std::gslice gs(0, len, stride);
+  while (st.KeepRunning()) {
+    y[gs] += x[gs];
+    benchmark::DoNotOptimize(&y[0]);
+  }
+  st.SetItemsProcessed(st.iterations() * (n / 2));
+}
+BENCHMARK_TEMPLATE(BM_GsliceAxpy, double)->Arg(1 << 12);
+
+BENCHMARK_MAIN()
@@ -28,5 +28,34 @@ BENCHMARK_CAPTURE(BM_ConstructIterIter,
   std::vector<std::string>{},
   getRandomStringInputs)->Arg(TestNumInputs);
 
+BENCHMARK_CAPTURE(BM_PushBack,
+  vector_size_t,
+  std::vector<size_t>{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_PushBack,
+  vector_string,
+  std::vector<std::string>{},
+  getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertEraseMiddle,
+  vector_size_t,
+  std::vector<size_t>{},
+  getRandomIntegerInputs<size_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertEraseMiddle,
+  vector_string,
+  std::vector<std::string>{},
+  getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ReadFile,
+  vector_char_resize,
+  std::vector<char>{},
+  false)->Range(1 << 12, 1 << 24);
+
+BENCHMARK_CAPTURE(BM_ReadFile,
+  vector_char_default_init,
+  std::vector<char>{},
+  true)->Range(1 << 12, 1 << 24);
 
 BENCHMARK_MAIN()
@@ -14,8 +14,11 @@
 #include <Windows.h>
 #else
 #include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 #include <errno.h>
+#include <cstring>
 
 _LIBCPP_BEGIN_NAMESPACE_EXPERIMENTAL_FILESYSTEM
 
@@ -42,18 +45,47 @@ inline bool set_or_throw(std::error_code& my_ec,
 }
 
 #if !defined(_LIBCPP_WIN32API)
-inline path::string_type posix_readdir(DIR *dir_stream, error_code& ec) {
+// Returns the type of the entry without following symlinks, or
+// file_type::none when readdir() did not report it.
+inline file_type get_file_type(struct dirent* ent) {
+#if defined(DT_UNKNOWN)
+    switch (ent->d_type) {
+    case DT_BLK:  return file_type::block;
+    case DT_CHR:  return file_type::character;
+    case DT_DIR:  return file_type::directory;
+    case DT_FIFO: return file_type::fifo;
+    case DT_LNK:  return file_type::symlink;
+    case DT_REG:  return file_type::regular;
+    case DT_SOCK: return file_type::socket;
+    default:      return file_type::none;
+    }
+#else
+    ((void)ent);
+    return file_type::none;
+#endif
+}
+
+// Returns the name of the next entry, which is valid until the next call, or
+// nullptr at the end of the directory or on error.
+inline const char* posix_readdir(DIR *dir_stream, file_type& ft,
+                                 error_code& ec) {
     struct dirent* dir_entry_ptr = nullptr;
     errno = 0; // zero errno in order to detect errors
     ec.clear();
     if ((dir_entry_ptr = ::readdir(dir_stream)) == nullptr) {
         if (errno)
           ec = capture_errno();
-        return {};
+        return nullptr;
     } else {
+        ft = get_file_type(dir_entry_ptr);
         return dir_entry_ptr->d_name;
     }
 }
+
+inline bool is_dot_or_dot_dot(const char* name) {
+    return name[0] == '.' &&
+           (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+}
 #endif
 
 }}                                                       // namespace detail
@@ -85,6 +117,11 @@ public:
     }
   }
 
+  // Opens the directory that is the current entry of parent.
+  __dir_stream(const __dir_stream& parent, directory_options opts,
+               error_code& ec)
+      : __dir_stream(parent.__entry_.path(), opts, ec) {}
+
   ~__dir_stream() noexcept {
     if (__stream_ == INVALID_HANDLE_VALUE)
       return;
@@ -128,7 +165,8 @@ public:
     __dir_stream& operator=(const __dir_stream&) = delete;
 
     __dir_stream(__dir_stream&& other) noexcept
-        : __stream_(other.__stream_), __root_(std::move(other.__root_)),
+        : __stream_(other.__stream_), __name_pos_(other.__name_pos_),
+          __root_(std::move(other.__root_)),
           __entry_(std::move(other.__entry_))
     {
         other.__stream_ = nullptr;
@@ -140,11 +178,28 @@ public:
           __root_(root)
     {
         if ((__stream_ = ::opendir(root.c_str())) == nullptr) {
-            ec = detail::capture_errno();
-            const bool allow_eacess =
-                bool(opts & directory_options::skip_permission_denied);
-            if (allow_eacess && ec.value() == EACCES)
-                ec.clear();
+            set_open_error(opts, ec);
+            return;
+        }
+        advance(ec);
+    }
+
+    // Opens the directory that is the current entry of parent, relative to
+    // the parent's descriptor, so that the kernel does not resolve the whole
+    // path again at every level.
+    __dir_stream(const __dir_stream& parent, directory_options opts,
+                 error_code& ec)
+        : __stream_(nullptr),
+          __root_(parent.__entry_.path())
+    {
+        const char* name =
+            parent.__entry_.path().c_str() + parent.__name_pos_;
+        const int fd = ::openat(::dirfd(parent.__stream_), name,
+                                O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd == -1 || (__stream_ = ::fdopendir(fd)) == nullptr) {
+            set_open_error(opts, ec);
+            if (fd != -1)
+                ::close(fd);
             return;
         }
         advance(ec);
@@ -157,19 +212,30 @@ public:
 
     bool advance(error_code &ec) {
         while (true) {
-            auto str = detail::posix_readdir(__stream_,  ec);
-            if (str == "." || str == "..") {
-                continue;
-            } else if (ec || str.empty()) {
+            file_type ft = file_type::none;
+            const char* name = detail::posix_readdir(__stream_, ft, ec);
+            if (ec || name == nullptr) {
                 close();
                 return false;
+            } else if (detail::is_dot_or_dot_dot(name)) {
+                continue;
             } else {
-                __entry_.assign(__root_ / str);
+                __entry_.__assign_iter_entry(__root_, name, ft);
+                __name_pos_ =
+                    __entry_.path().native().size() - std::strlen(name);
                 return true;
             }
         }
     }
 private:
+    static void set_open_error(directory_options opts, error_code& ec) {
+        ec = detail::capture_errno();
+        const bool allow_eacess =
+            bool(opts & directory_options::skip_permission_denied);
+        if (allow_eacess && ec.value() == EACCES)
+            ec.clear();
+    }
+
     std::error_code close() noexcept {
         std::error_code m_ec;
         if (::closedir(__stream_) == -1)
@@ -179,6 +245,8 @@ private:
     }
 
     DIR * __stream_{nullptr};
+    // Where the file name of __entry_ starts in its path.
+    size_t __name_pos_{0};
 public:
     path __root_;
     directory_entry __entry_;
@@ -301,11 +369,15 @@ bool recursive_directory_iterator::__try_recursion(error_code *ec) {
         bool(options() & directory_options::follow_directory_symlink);
     auto& curr_it = __imp_->__stack_.top();
 
-    if (is_directory(curr_it.__entry_.status()) &&
-        (!is_symlink(curr_it.__entry_.symlink_status()) || rec_sym))
+    // The entry usually knows its own type from readdir(), so only symlinks,
+    // when they are followed, need a stat().
+    const bool is_dir = curr_it.__entry_.is_symlink()
+        ? rec_sym && curr_it.__entry_.is_directory()
+        : curr_it.__entry_.is_directory();
+    if (is_dir)
     {
         std::error_code m_ec;
-        __dir_stream new_it(curr_it.__entry_.path(), __imp_->__options_, m_ec);
+        __dir_stream new_it(curr_it, __imp_->__options_, m_ec);
         if (new_it.good()) {
             __imp_->__stack_.push(_VSTD::move(new_it));
             return true;
@@ -14,6 +14,13 @@
 #include "random"  /* for unique_path */
 #include "cstdlib"
 #include "climits"
+#if !defined(_LIBCPP_HAS_NO_THREADS)
+#include "thread"
+#include "mutex"
+#include "condition_variable"
+#include "deque"
+#include "vector"
+#endif
 
 #include <unistd.h>
 #include <sys/stat.h>
@@ -171,8 +178,13 @@ path __canonical(path const & orig_p, const path& base, std::error_code *ec)
     return {ret};
 }
 
-void __copy(const path& from, const path& to, copy_options options,
-            std::error_code *ec)
+namespace {
+
+// Does what copy() does, except for copying the entries of a directory.
+// Returns true when from is a directory whose entries are to be copied into
+// to, which then exists.
+bool copy_impl(const path& from, const path& to, copy_options options,
+               std::error_code *ec)
 {
     const bool sym_status = bool(options &
         (copy_options::create_symlinks | copy_options::skip_symlinks));
@@ -185,22 +197,27 @@ void __copy(const path& from, const path& to, copy_options options,
     const file_status f = sym_status || sym_status2
                                      ? detail::posix_lstat(from, f_st, &m_ec)
                                      : detail::posix_stat(from,  f_st, &m_ec);
-    if (m_ec)
-        return set_or_throw(m_ec, ec, "copy", from, to);
+    if (m_ec) {
+        set_or_throw(m_ec, ec, "copy", from, to);
+        return false;
+    }
 
     struct ::stat t_st = {};
     const file_status t = sym_status ? detail::posix_lstat(to, t_st, &m_ec)
                                      : detail::posix_stat(to, t_st, &m_ec);
 
-    if (not status_known(t))
-        return set_or_throw(m_ec, ec, "copy", from, to);
+    if (not status_known(t)) {
+        set_or_throw(m_ec, ec, "copy", from, to);
+        return false;
+    }
 
     if (!exists(f) || is_other(f) || is_other(t)
         || (is_directory(f) && is_regular_file(t))
         || detail::stat_equivalent(f_st, t_st))
     {
-        return set_or_throw(make_error_code(errc::function_not_supported),
-                            ec, "copy", from, to);
+        set_or_throw(make_error_code(errc::function_not_supported),
+                     ec, "copy", from, to);
+        return false;
     }
 
     if (ec) ec->clear();
@@ -214,7 +231,6 @@ void __copy(const path& from, const path& to, copy_options options,
             set_or_throw(make_error_code(errc::file_exists),
                          ec, "copy", from, to);
         }
-        return;
     }
     else if (is_regular_file(f)) {
         if (bool(copy_options::directories_only & options)) {
@@ -231,10 +247,9 @@ void __copy(const path& from, const path& to, copy_options options,
         } else {
             __copy_file(from, to, options, ec);
         }
-        return;
     }
     else if (is_directory(f) && bool(copy_options::create_symlinks & options)) {
-        return set_or_throw(make_error_code(errc::is_a_directory), ec, "copy");
+        set_or_throw(make_error_code(errc::is_a_directory), ec, "copy");
     }
     else if (is_directory(f) && (bool(copy_options::recursive & options) ||
              copy_options::none == options)) {
@@ -242,18 +257,29 @@ void __copy(const path& from, const path& to, copy_options options,
         if (!exists(t)) {
             // create directory to with attributes from 'from'.
             __create_directory(to, from, ec);
-            if (ec && *ec) { return; }
+            if (ec && *ec) { return false; }
         }
-        directory_iterator it = ec ? directory_iterator(from, *ec)
-                                   : directory_iterator(from);
+        return true;
+    }
+    return false;
+}
+
+} // end namespace
+
+void __copy(const path& from, const path& to, copy_options options,
+            std::error_code *ec)
+{
+    if (!copy_impl(from, to, options, ec))
+        return;
+    directory_iterator it = ec ? directory_iterator(from, *ec)
+                               : directory_iterator(from);
+    if (ec && *ec) { return; }
+    std::error_code m_ec;
+    for (; it != directory_iterator(); it.increment(m_ec)) {
+        if (m_ec) return set_or_throw(m_ec, ec, "copy", from, to);
+        __copy(it->path(), to / it->path().filename(),
+               options | copy_options::__in_recursive_copy, ec);
         if (ec && *ec) { return; }
-        std::error_code m_ec;
-        for (; it != directory_iterator(); it.increment(m_ec)) {
-            if (m_ec) return set_or_throw(m_ec, ec, "copy", from, to);
-            __copy(it->path(), to / it->path().filename(),
-                   options | copy_options::__in_recursive_copy, ec);
-            if (ec && *ec) { return; }
-        }
     }
 }
 
@@ -802,16 +828,19 @@ bool __remove(const path& p, std::error_code *ec) {
 
 namespace {
 
-std::uintmax_t remove_all_impl(path const & p, std::error_code& ec)
+std::uintmax_t remove_all_impl(path const & p, bool is_dir,
+                               std::error_code& ec)
 {
     const auto npos = static_cast<std::uintmax_t>(-1);
-    const file_status st = __symlink_status(p, &ec);
-    if (ec) return npos;
      std::uintmax_t count = 1;
-    if (is_directory(st)) {
+    if (is_dir) {
         for (directory_iterator it(p, ec); !ec && it != directory_iterator();
              it.increment(ec)) {
-            auto other_count = remove_all_impl(it->path(), ec);
+            // The type readdir() reported saves an lstat() per entry.
+            const bool child_is_dir = !it->is_symlink(ec) && !ec
+                                      && it->is_directory(ec);
+            if (ec) return npos;
+            auto other_count = remove_all_impl(it->path(), child_is_dir, ec);
             if (ec) return npos;
             count += other_count;
         }
@@ -825,7 +854,9 @@ std::uintmax_t remove_all_impl(path const & p, std::error_code& ec)
 
 std::uintmax_t __remove_all(const path& p, std::error_code *ec) {
     std::error_code mec;
-    auto count = remove_all_impl(p, mec);
+    const file_status st = __symlink_status(p, &mec);
+    auto count = mec ? static_cast<std::uintmax_t>(-1)
+                     : remove_all_impl(p, is_directory(st), mec);
     if (mec) {
         set_or_throw(mec, ec, "remove_all", p);
         return static_cast<std::uintmax_t>(-1);
@@ -834,6 +865,197 @@ std::uintmax_t __remove_all(const path& p, std::error_code *ec) {
     return count;
 }
 
+#if !defined(_LIBCPP_HAS_NO_THREADS)
+namespace {
+
+// Works through a queue of directories on a pool of threads.  A thread has
+// at most one directory open at a time, so the size of the pool bounds the
+// number of descriptors in use.  The first error stops the walk.
+template <class Task>
+class parallel_walk {
+public:
+    // May be called from the function passed to run().
+    void push(Task t) {
+        {
+            lock_guard<mutex> lk(__mut_);
+            __tasks_.push_back(_VSTD::move(t));
+        }
+        __cv_.notify_one();
+    }
+
+    // Calls fn(task, ec) for the queued tasks, and those they queue, until
+    // there are none left or one sets ec.  Returns the first error.
+    template <class Fn>
+    std::error_code run(Fn fn) {
+        const unsigned hw = thread::hardware_concurrency();
+        const unsigned n = hw < 2 ? 2 : (hw > 16 ? 16 : hw);
+        vector<thread> threads;
+        threads.reserve(n - 1);
+#ifndef _LIBCPP_NO_EXCEPTIONS
+        try {
+#endif
+            for (unsigned i = 1; i < n; ++i)
+                threads.emplace_back([this, &fn] { work(fn); });
+#ifndef _LIBCPP_NO_EXCEPTIONS
+        } catch (const system_error&) {
+            // Go on with the threads there are.
+        }
+#endif
+        work(fn);
+        for (auto& t : threads)
+            t.join();
+        return __ec_;
+    }
+
+private:
+    template <class Fn>
+    void work(Fn& fn) {
+        unique_lock<mutex> lk(__mut_);
+        while (true) {
+            __cv_.wait(lk, [this] {
+                return !__tasks_.empty() || __busy_ == 0 || __ec_;
+            });
+            // With no tasks queued, no thread is busy either.
+            if (__ec_ || __tasks_.empty())
+                return;
+            Task t = _VSTD::move(__tasks_.front());
+            __tasks_.pop_front();
+            ++__busy_;
+            lk.unlock();
+            std::error_code m_ec;
+            fn(t, m_ec);
+            lk.lock();
+            --__busy_;
+            if (m_ec && !__ec_)
+                __ec_ = m_ec;
+            if (__ec_ || (__busy_ == 0 && __tasks_.empty()))
+                __cv_.notify_all();
+        }
+    }
+
+    mutex __mut_;
+    condition_variable __cv_;
+    deque<Task> __tasks_;
+    unsigned __busy_ = 0;
+    std::error_code __ec_;
+};
+
+// A directory is removed by the thread that removes the last of its
+// subdirectories, or by the one that lists it if it has none left by then.
+struct remove_all_dir {
+    path __p_;
+    remove_all_dir* __parent_;
+    // Subdirectories not yet removed, plus one until the listing is done.
+    size_t __pending_;
+};
+
+std::uintmax_t parallel_remove_all_impl(const path& p, std::error_code& ec)
+{
+    mutex mut; // guards dirs, every __pending_ and count
+    deque<remove_all_dir> dirs;
+    std::uintmax_t count = 0;
+    parallel_walk<remove_all_dir*> walk;
+
+    dirs.push_back(remove_all_dir{p, nullptr, 1});
+    walk.push(&dirs.back());
+    ec = walk.run([&](remove_all_dir* d, std::error_code& m_ec) {
+        std::uintmax_t files = 0;
+        for (directory_iterator it(d->__p_, m_ec);
+             !m_ec && it != directory_iterator(); it.increment(m_ec)) {
+            const bool is_dir = !it->is_symlink(m_ec) && !m_ec
+                                && it->is_directory(m_ec);
+            if (m_ec) return;
+            if (is_dir) {
+                remove_all_dir* child;
+                {
+                    lock_guard<mutex> lk(mut);
+                    dirs.push_back(remove_all_dir{it->path(), d, 1});
+                    child = &dirs.back();
+                    ++d->__pending_;
+                }
+                walk.push(child);
+            } else {
+                if (!__remove(it->path(), &m_ec)) return;
+                ++files;
+            }
+        }
+        if (m_ec) return;
+        unique_lock<mutex> lk(mut);
+        count += files;
+        while (d && --d->__pending_ == 0) {
+            lk.unlock();
+            if (!__remove(d->__p_, &m_ec)) return;
+            lk.lock();
+            ++count;
+            d = d->__parent_;
+        }
+    });
+    return ec ? static_cast<std::uintmax_t>(-1) : count;
+}
+
+struct copy_dir {
+    path __from_;
+    path __to_;
+};
+
+std::error_code parallel_copy_impl(const path& from, const path& to,
+                                   copy_options options)
+{
+    parallel_walk<copy_dir> walk;
+    walk.push(copy_dir{from, to});
+    options |= copy_options::__in_recursive_copy;
+    return walk.run([&](copy_dir& d, std::error_code& m_ec) {
+        for (directory_iterator it(d.__from_, m_ec);
+             !m_ec && it != directory_iterator(); it.increment(m_ec)) {
+            path dest = d.__to_ / it->path().filename();
+            if (copy_impl(it->path(), dest, options, &m_ec))
+                walk.push(copy_dir{it->path(), _VSTD::move(dest)});
+            if (m_ec) return;
+        }
+    });
+}
+
+} // end namespace
+#endif // !_LIBCPP_HAS_NO_THREADS
+
+std::uintmax_t __parallel_remove_all(const path& p, std::error_code *ec) {
+#if defined(_LIBCPP_HAS_NO_THREADS)
+    return __remove_all(p, ec);
+#else
+    std::error_code mec;
+    const file_status st = __symlink_status(p, &mec);
+    std::uintmax_t count = static_cast<std::uintmax_t>(-1);
+    if (!mec) {
+        if (is_directory(st))
+            count = parallel_remove_all_impl(p, mec);
+        else if (__remove(p, &mec))
+            count = 1;
+    }
+    if (mec) {
+        set_or_throw(mec, ec, "parallel_remove_all", p);
+        return static_cast<std::uintmax_t>(-1);
+    }
+    if (ec) ec->clear();
+    return count;
+#endif
+}
+
+void __parallel_copy(const path& from, const path& to, copy_options options,
+                     std::error_code *ec)
+{
+#if defined(_LIBCPP_HAS_NO_THREADS)
+    __copy(from, to, options, ec);
+#else
+    std::error_code m_ec;
+    if (copy_impl(from, to, options, &m_ec))
+        m_ec = parallel_copy_impl(from, to, options);
+    if (m_ec)
+        set_or_throw(m_ec, ec, "parallel_copy", from, to);
+    else if (ec)
+        ec->clear();
+#endif
+}
+
 void __rename(const path& from, const path& to, std::error_code *ec) {
     if (::rename(from.c_str(), to.c_str()) == -1)
         set_or_throw(ec, "rename", from, to);
@@ -377,8 +377,36 @@ string_view_t path::__extension() const
 ////////////////////////////////////////////////////////////////////////////
 // path.comparisons
 int path::__compare(string_view_t __s) const {
-    auto PP = PathParser::CreateBegin(__pn_);
-    auto PP2 = PathParser::CreateBegin(__s);
+    const string_view_t P = __pn_;
+    size_t Common = 0;
+    const size_t MinSize = std::min(P.size(), __s.size());
+    while (Common < MinSize && P[Common] == __s[Common])
+      ++Common;
+    if (Common == P.size() && Common == __s.size())
+      return 0;
+    // The elements of both paths agree up to the last name that ends before
+    // a separator in the common prefix.  Resume comparing after that name,
+    // unless it is the root name.
+    size_t NameEnd = Common;
+    while (NameEnd > 0 && P[NameEnd - 1] != '/')
+      --NameEnd;
+    while (NameEnd > 0 && P[NameEnd - 1] == '/')
+      --NameEnd;
+    size_t NameStart = NameEnd;
+    while (NameStart > 0 && P[NameStart - 1] != '/')
+      --NameStart;
+    const bool Resume = NameStart != NameEnd &&
+        !(NameStart == 2 && P[0] == '/' && P[1] == '/');
+    auto CreateAfterCommon = [&](string_view_t Path) {
+      if (!Resume)
+        return PathParser::CreateBegin(Path);
+      PathParser PP(Path, Path.substr(NameStart, NameEnd - NameStart),
+                    PathParser::PS_InFilenames);
+      ++PP;
+      return PP;
+    };
+    auto PP = CreateAfterCommon(P);
+    auto PP2 = CreateAfterCommon(__s);
     while (PP && PP2) {
         int res = (*PP).compare(*PP2);
         if (res != 0) return res;
@@ -36,6 +36,9 @@
 #endif
 #include <stdlib.h>
 #include <stdio.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // On Linux, wint_t and wchar_t have different signed-ness, and this causes
 // lots of noise in the build log, but no bugs that I know of. 
@@ -169,8 +172,21 @@ private:
     void install(facet* f, long id);
     template <class F> void install(F* f) {install(f, f->id.__get());}
     template <class F> void install_from(const __imp& other);
+
+    // The classic locale is never destroyed, so the facets it holds outlive
+    // every other locale.  Other locales sharing one of them in the same slot
+    // skip the reference count traffic for it, which keeps copying a table of
+    // mostly classic facets down to a memcpy.
+    static const __imp* classic_;
+    static bool is_classic(const facet* f, size_t i)
+        {return classic_ != nullptr && i < classic_->facets_.size() &&
+                classic_->facets_[i] == f;}
+    void add_shared_facets();
+    void release_shared_facets();
 };
 
+const locale::__imp* locale::__imp::classic_ = nullptr;
+
 locale::__imp::__imp(size_t refs)
     : facet(refs),
       facets_(N),
@@ -217,9 +233,6 @@ locale::__imp::__imp(const string& name, size_t refs)
     {
 #endif  // _LIBCPP_NO_EXCEPTIONS
         facets_ = locale::classic().__locale_->facets_;
-        for (unsigned i = 0; i < facets_.size(); ++i)
-            if (facets_[i])
-                facets_[i]->__add_shared();
         install(new collate_byname<char>(name_));
         install(new collate_byname<wchar_t>(name_));
         install(new ctype_byname<char>(name_));
@@ -244,9 +257,7 @@ locale::__imp::__imp(const string& name, size_t refs)
     }
     catch (...)
     {
-        for (unsigned i = 0; i < facets_.size(); ++i)
-            if (facets_[i])
-                facets_[i]->__release_shared();
+        release_shared_facets();
         throw;
     }
 #endif  // _LIBCPP_NO_EXCEPTIONS
@@ -264,9 +275,7 @@ locale::__imp::__imp(const __imp& other)
       name_(other.name_)
 {
     facets_ = other.facets_;
-    for (unsigned i = 0; i < facets_.size(); ++i)
-        if (facets_[i])
-            facets_[i]->__add_shared();
+    add_shared_facets();
 }
 
 #if defined(__clang__) || _GNUC_VER >= 406
@@ -274,13 +283,11 @@ locale::__imp::__imp(const __imp& other)
 #endif
 
 locale::__imp::__imp(const __imp& other, const string& name, locale::category c)
-    : facets_(N),
+    : facets_(max<size_t>(N, other.facets_.size())),
       name_("*")
 {
     facets_ = other.facets_;
-    for (unsigned i = 0; i < facets_.size(); ++i)
-        if (facets_[i])
-            facets_[i]->__add_shared();
+    add_shared_facets();
 #ifndef _LIBCPP_NO_EXCEPTIONS
     try
     {
@@ -327,9 +334,7 @@ locale::__imp::__imp(const __imp& other, const string& name, locale::category c)
     }
     catch (...)
     {
-        for (unsigned i = 0; i < facets_.size(); ++i)
-            if (facets_[i])
-                facets_[i]->__release_shared();
+        release_shared_facets();
         throw;
     }
 #endif  // _LIBCPP_NO_EXCEPTIONS
@@ -345,13 +350,11 @@ locale::__imp::install_from(const locale::__imp& one)
 }
 
 locale::__imp::__imp(const __imp& other, const __imp& one, locale::category c)
-    : facets_(N),
+    : facets_(max<size_t>(N, other.facets_.size())),
       name_("*")
 {
     facets_ = other.facets_;
-    for (unsigned i = 0; i < facets_.size(); ++i)
-        if (facets_[i])
-            facets_[i]->__add_shared();
+    add_shared_facets();
 #ifndef _LIBCPP_NO_EXCEPTIONS
     try
     {
@@ -406,9 +409,7 @@ locale::__imp::__imp(const __imp& other, const __imp& one, locale::category c)
     }
     catch (...)
     {
-        for (unsigned i = 0; i < facets_.size(); ++i)
-            if (facets_[i])
-                facets_[i]->__release_shared();
+        release_shared_facets();
         throw;
     }
 #endif  // _LIBCPP_NO_EXCEPTIONS
@@ -421,29 +422,45 @@ locale::__imp::__imp(const __imp& other, facet* f, long id)
     f->__add_shared();
     unique_ptr<facet, release> hold(f);
     facets_ = other.facets_;
-    for (unsigned i = 0; i < other.facets_.size(); ++i)
-        if (facets_[i])
-            facets_[i]->__add_shared();
+    add_shared_facets();
     install(hold.get(), id);
 }
 
 locale::__imp::~__imp()
 {
-    for (unsigned i = 0; i < facets_.size(); ++i)
-        if (facets_[i])
+    release_shared_facets();
+}
+
+void
+locale::__imp::add_shared_facets()
+{
+    for (size_t i = 0; i < facets_.size(); ++i)
+        if (facets_[i] && !is_classic(facets_[i], i))
+            facets_[i]->__add_shared();
+}
+
+void
+locale::__imp::release_shared_facets()
+{
+    for (size_t i = 0; i < facets_.size(); ++i)
+        if (facets_[i] && !is_classic(facets_[i], i))
             facets_[i]->__release_shared();
 }
 
 void
 locale::__imp::install(facet* f, long id)
 {
-    f->__add_shared();
-    unique_ptr<facet, release> hold(f);
-    if (static_cast<size_t>(id) >= facets_.size())
-        facets_.resize(static_cast<size_t>(id+1));
-    if (facets_[static_cast<size_t>(id)])
-        facets_[static_cast<size_t>(id)]->__release_shared();
-    facets_[static_cast<size_t>(id)] = hold.release();
+    const size_t i = static_cast<size_t>(id);
+    const bool counted = !is_classic(f, i);
+    if (counted)
+        f->__add_shared();
+    unique_ptr<facet, release> hold(counted ? f : nullptr);
+    if (i >= facets_.size())
+        facets_.resize(i+1);
+    if (facets_[i] && !is_classic(facets_[i], i))
+        facets_[i]->__release_shared();
+    facets_[i] = f;
+    hold.release();
 }
 
 const locale::facet*
@@ -465,6 +482,7 @@ locale::__imp::make_classic()
     static aligned_storage<sizeof(locale)>::type buf;
     locale* c = reinterpret_cast<locale*>(&buf);
     c->__locale_ = &make<__imp>(1u);
+    __imp::classic_ = c->__locale_;
     return *c;
 }
 
@@ -927,9 +945,39 @@ ctype<char>::do_toupper(char_type c) const
 #endif
 }
 
+#if defined(__SSE2__)
+
+namespace {
+
+// The classic table only maps 'a'-'z' and 'A'-'Z', so whole blocks can be
+// converted by adding delta to the bytes in [first, first + 25].
+char*
+shift_case_sse2(char* low, const char* high, char first, char delta)
+{
+    const __m128i lo = _mm_set1_epi8(first);
+    const __m128i span = _mm_set1_epi8(25);
+    const __m128i d = _mm_set1_epi8(delta);
+    for (; high - low >= 16; low += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(low));
+        __m128i off = _mm_sub_epi8(v, lo);
+        __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(off, span), off);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(low),
+                         _mm_add_epi8(v, _mm_and_si128(in, d)));
+    }
+    return low;
+}
+
+}  // namespace
+
+#endif  // __SSE2__
+
 const char*
 ctype<char>::do_toupper(char_type* low, const char_type* high) const
 {
+#if defined(__SSE2__)
+    low = shift_case_sse2(low, high, 'a', 'A' - 'a');
+#endif
     for (; low != high; ++low)
 #ifdef _LIBCPP_HAS_DEFAULTRUNELOCALE
         *low = isascii(*low) ?
@@ -964,6 +1012,9 @@ ctype<char>::do_tolower(char_type c) const
 const char*
 ctype<char>::do_tolower(char_type* low, const char_type* high) const
 {
+#if defined(__SSE2__)
+    low = shift_case_sse2(low, high, 'A', 'a' - 'A');
+#endif
     for (; low != high; ++low)
 #ifdef _LIBCPP_HAS_DEFAULTRUNELOCALE
         *low = isascii(*low) ? static_cast<char>(_DefaultRuneLocale.__maplower[static_cast<ptrdiff_t>(*low)]) : *low;
@@ -977,6 +1028,62 @@ ctype<char>::do_tolower(char_type* low, const char_type* high) const
     return low;
 }
 
+const char*
+ctype<char>::__scan_classic(mask m, const char_type* low, const char_type* high,
+                            bool is) _NOEXCEPT
+{
+    const mask* tab = classic_table();
+#if defined(__SSE2__)
+    // Every class in the classic table is a handful of contiguous runs of
+    // ASCII characters.  Find the runs for m, then test 16 bytes at a time
+    // with one unsigned range compare per run.
+    const int max_runs = 8;
+    unsigned char first[max_runs];
+    unsigned char span[max_runs];
+    int runs = 0;
+    for (int c = 0; c < 128 && runs <= max_runs;)
+    {
+        if (!(tab[c] & m))
+        {
+            ++c;
+            continue;
+        }
+        int b = c;
+        while (c < 128 && (tab[c] & m))
+            ++c;
+        if (runs < max_runs)
+        {
+            first[runs] = static_cast<unsigned char>(b);
+            span[runs] = static_cast<unsigned char>(c - 1 - b);
+        }
+        ++runs;
+    }
+    if (runs <= max_runs)
+    {
+        for (; high - low >= 16; low += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(low));
+            __m128i in = _mm_setzero_si128();
+            for (int i = 0; i < runs; ++i)
+            {
+                __m128i off = _mm_sub_epi8(v, _mm_set1_epi8(static_cast<char>(first[i])));
+                __m128i lim = _mm_set1_epi8(static_cast<char>(span[i]));
+                in = _mm_or_si128(in, _mm_cmpeq_epi8(_mm_min_epu8(off, lim), off));
+            }
+            unsigned bits = static_cast<unsigned>(_mm_movemask_epi8(in));
+            if (!is)
+                bits ^= 0xFFFF;
+            if (bits)
+                return low + __builtin_ctz(bits);
+        }
+    }
+#endif  // __SSE2__
+    for (; low != high; ++low)
+        if ((isascii(*low) && (tab[static_cast<int>(*low)] & m)) == is)
+            break;
+    return low;
+}
+
 char
 ctype<char>::do_widen(char c) const
 {
@@ -1718,6 +1825,208 @@ codecvt<wchar_t, char, mbstate_t>::do_max_length() const  _NOEXCEPT
 // 040000 - 0FFFFF  D8C0 - DBBF, DC00 - DFFF  F1 - F3, 80 - BF, 80 - BF, 80 - BF   786432
 // 100000 - 10FFFF  DBC0 - DBFF, DC00 - DFFF  F4 - F4, 80 - 8F, 80 - BF, 80 - BF    65536
 
+// Runs of ASCII are by far the most common input to the UTF-8 transcoders
+// below.  These helpers are called at an ASCII character and move the whole
+// run that follows it: a short run straight from a look at the next eight
+// bytes, a long one 16 characters at a time.  They leave the last few
+// characters before either range runs out to the scalar loops, and return
+// the number of characters moved.
+
+#if defined(__SSE2__)
+// The number of leading characters of the given bit width in the eight
+// bytes at p that have no bits set under non_ascii.
+static inline
+unsigned
+ascii_head(const void* p, uint64_t non_ascii, unsigned bits)
+{
+    uint64_t w;
+    memcpy(&w, p, sizeof(w));
+    w &= non_ascii;
+    return w == 0 ? 64 / bits : static_cast<unsigned>(__builtin_ctzll(w)) / bits;
+}
+#endif
+
+static inline
+size_t
+ascii_prefix_length(const uint8_t* frm, const uint8_t* frm_end)
+{
+    const uint8_t* p = frm;
+#if defined(__SSE2__)
+    if (frm_end - p < 16)
+        return 0;
+    unsigned n = ascii_head(p, 0x8080808080808080ULL, 8);
+    if (n < 8)
+        return n;
+    for (; frm_end - p >= 16; p += 16)
+    {
+        int m = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        if (m != 0)
+            return static_cast<size_t>(p - frm) + __builtin_ctz(m);
+    }
+#endif
+    return static_cast<size_t>(p - frm);
+}
+
+static inline
+size_t
+widen_ascii(const uint8_t*& frm, const uint8_t* frm_end, uint16_t* to, uint16_t* to_end)
+{
+    uint16_t* p = to;
+#if defined(__SSE2__)
+    if (frm_end - frm < 16 || to_end - p < 16)
+        return 0;
+    unsigned n = ascii_head(frm, 0x8080808080808080ULL, 8);
+    if (n < 8)
+    {
+        for (unsigned i = 0; i < n; ++i)
+            p[i] = frm[i];
+        frm += n;
+        return n;
+    }
+    const __m128i zero = _mm_setzero_si128();
+    for (; frm_end - frm >= 16 && to_end - p >= 16; frm += 16, p += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(frm));
+        if (int m = _mm_movemask_epi8(v))
+        {
+            for (const uint8_t* e = frm + __builtin_ctz(m); frm != e; ++frm, ++p)
+                *p = *frm;
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p),     _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#endif
+    return static_cast<size_t>(p - to);
+}
+
+static inline
+size_t
+widen_ascii(const uint8_t*& frm, const uint8_t* frm_end, uint32_t* to, uint32_t* to_end)
+{
+    uint32_t* p = to;
+#if defined(__SSE2__)
+    if (frm_end - frm < 16 || to_end - p < 16)
+        return 0;
+    unsigned n = ascii_head(frm, 0x8080808080808080ULL, 8);
+    if (n < 8)
+    {
+        for (unsigned i = 0; i < n; ++i)
+            p[i] = frm[i];
+        frm += n;
+        return n;
+    }
+    const __m128i zero = _mm_setzero_si128();
+    for (; frm_end - frm >= 16 && to_end - p >= 16; frm += 16, p += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(frm));
+        if (int m = _mm_movemask_epi8(v))
+        {
+            for (const uint8_t* e = frm + __builtin_ctz(m); frm != e; ++frm, ++p)
+                *p = *frm;
+            break;
+        }
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p),      _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 4),  _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 8),  _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 12), _mm_unpackhi_epi16(hi, zero));
+    }
+#endif
+    return static_cast<size_t>(p - to);
+}
+
+static inline
+size_t
+narrow_ascii(const uint16_t* frm, const uint16_t* frm_end, uint8_t*& to_nxt, uint8_t* to_end)
+{
+    const uint16_t* p = frm;
+#if defined(__SSE2__)
+    uint8_t* to = to_nxt;
+    if (frm_end - p < 16 || to_end - to < 16)
+        return 0;
+    unsigned n = ascii_head(p, 0xFF80FF80FF80FF80ULL, 16);
+    if (n == 4)
+        n += ascii_head(p + 4, 0xFF80FF80FF80FF80ULL, 16);
+    if (n < 8)
+    {
+        for (unsigned i = 0; i < n; ++i)
+            to[i] = static_cast<uint8_t>(p[i]);
+        to_nxt = to + n;
+        return n;
+    }
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    for (; frm_end - p >= 16 && to_end - to >= 16; p += 16, to += 16)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8));
+        // Two mask bits per character, set for ASCII.
+        unsigned m = static_cast<unsigned>(
+                  _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(a, non_ascii), zero))) |
+            static_cast<unsigned>(
+                  _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(b, non_ascii), zero))) << 16;
+        if (m != 0xFFFFFFFF)
+        {
+            for (const uint16_t* e = p + __builtin_ctz(~m) / 2; p != e; ++p, ++to)
+                *to = static_cast<uint8_t>(*p);
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(to), _mm_packus_epi16(a, b));
+    }
+    to_nxt = to;
+#endif
+    return static_cast<size_t>(p - frm);
+}
+
+static inline
+size_t
+narrow_ascii(const uint32_t* frm, const uint32_t* frm_end, uint8_t*& to_nxt, uint8_t* to_end)
+{
+    const uint32_t* p = frm;
+#if defined(__SSE2__)
+    uint8_t* to = to_nxt;
+    if (frm_end - p < 16 || to_end - to < 16)
+        return 0;
+    unsigned n = 0;
+    for (unsigned k = 2; k == 2 && n < 8; n += k)
+        k = ascii_head(p + n, 0xFFFFFF80FFFFFF80ULL, 32);
+    if (n < 8)
+    {
+        for (unsigned i = 0; i < n; ++i)
+            to[i] = static_cast<uint8_t>(p[i]);
+        to_nxt = to + n;
+        return n;
+    }
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i non_ascii = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+    for (; frm_end - p >= 16 && to_end - to >= 16; p += 16, to += 16)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12));
+        // One mask bit per character, set for ASCII.
+        unsigned m = static_cast<unsigned>(
+                _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(a, non_ascii), zero))) |
+                _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(b, non_ascii), zero))) << 4 |
+                _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(c, non_ascii), zero))) << 8 |
+                _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(d, non_ascii), zero))) << 12);
+        if (m != 0xFFFF)
+        {
+            for (const uint32_t* e = p + __builtin_ctz(~m); p != e; ++p, ++to)
+                *to = static_cast<uint8_t>(*p);
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(to),
+                         _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    to_nxt = to;
+#endif
+    return static_cast<size_t>(p - frm);
+}
+
 static
 codecvt_base::result
 utf16_to_utf8(const uint16_t* frm, const uint16_t* frm_end, const uint16_t*& frm_nxt,
@@ -1744,6 +2053,8 @@ utf16_to_utf8(const uint16_t* frm, const uint16_t* frm_end, const uint16_t*& frm
             if (to_end-to_nxt < 1)
                 return codecvt_base::partial;
             *to_nxt++ = static_cast<uint8_t>(wc1);
+            if (Maxcode >= 0x7F)
+                frm_nxt += narrow_ascii(frm_nxt + 1, frm_end, to_nxt, to_end);
         }
         else if (wc1 < 0x0800)
         {
@@ -1821,6 +2132,8 @@ utf16_to_utf8(const uint32_t* frm, const uint32_t* frm_end, const uint32_t*& frm
             if (to_end-to_nxt < 1)
                 return codecvt_base::partial;
             *to_nxt++ = static_cast<uint8_t>(wc1);
+            if (Maxcode >= 0x7F)
+                frm_nxt += narrow_ascii(frm_nxt + 1, frm_end, to_nxt, to_end);
         }
         else if (wc1 < 0x0800)
         {
@@ -1895,6 +2208,8 @@ utf8_to_utf16(const uint8_t* frm, const uint8_t* frm_end, const uint8_t*& frm_nx
         {
             *to_nxt = static_cast<uint16_t>(c1);
             ++frm_nxt;
+            if (Maxcode >= 0x7F)
+                to_nxt += widen_ascii(frm_nxt, frm_end, to_nxt + 1, to_end);
         }
         else if (c1 < 0xC2)
         {
@@ -2016,6 +2331,8 @@ utf8_to_utf16(const uint8_t* frm, const uint8_t* frm_end, const uint8_t*& frm_nx
         {
             *to_nxt = static_cast<uint32_t>(c1);
             ++frm_nxt;
+            if (Maxcode >= 0x7F)
+                to_nxt += widen_ascii(frm_nxt, frm_end, to_nxt + 1, to_end);
         }
         else if (c1 < 0xC2)
         {
@@ -2135,6 +2452,12 @@ utf8_to_utf16_length(const uint8_t* frm, const uint8_t* frm_end,
         if (c1 < 0x80)
         {
             ++frm_nxt;
+            if (Maxcode >= 0x7F)
+            {
+                size_t n = _VSTD::min(ascii_prefix_length(frm_nxt, frm_end), mx - nchar16_t - 1);
+                frm_nxt += n;
+                nchar16_t += n;
+            }
         }
         else if (c1 < 0xC2)
         {
@@ -2241,6 +2564,8 @@ ucs4_to_utf8(const uint32_t* frm, const uint32_t* frm_end, const uint32_t*& frm_
             if (to_end-to_nxt < 1)
                 return codecvt_base::partial;
             *to_nxt++ = static_cast<uint8_t>(wc);
+            if (Maxcode >= 0x7F)
+                frm_nxt += narrow_ascii(frm_nxt + 1, frm_end, to_nxt, to_end);
         }
         else if (wc < 0x000800)
         {
@@ -2293,6 +2618,8 @@ utf8_to_ucs4(const uint8_t* frm, const uint8_t* frm_end, const uint8_t*& frm_nxt
                 return codecvt_base::error;
             *to_nxt = static_cast<uint32_t>(c1);
             ++frm_nxt;
+            if (Maxcode >= 0x7F)
+                to_nxt += widen_ascii(frm_nxt, frm_end, to_nxt + 1, to_end);
         }
         else if (c1 < 0xC2)
         {
@@ -2405,6 +2732,12 @@ utf8_to_ucs4_length(const uint8_t* frm, const uint8_t* frm_end,
             if (c1 > Maxcode)
                 break;
             ++frm_nxt;
+            if (Maxcode >= 0x7F)
+            {
+                size_t n = _VSTD::min(ascii_prefix_length(frm_nxt, frm_end), mx - nchar32_t - 1);
+                frm_nxt += n;
+                nchar32_t += n;
+            }
         }
         else if (c1 < 0xC2)
         {
@@ -2508,6 +2841,8 @@ ucs2_to_utf8(const uint16_t* frm, const uint16_t* frm_end, const uint16_t*& frm_
             if (to_end-to_nxt < 1)
                 return codecvt_base::partial;
             *to_nxt++ = static_cast<uint8_t>(wc);
+            if (Maxcode >= 0x7F)
+                frm_nxt += narrow_ascii(frm_nxt + 1, frm_end, to_nxt, to_end);
         }
         else if (wc < 0x0800)
         {
@@ -2551,6 +2886,8 @@ utf8_to_ucs2(const uint8_t* frm, const uint8_t* frm_end, const uint8_t*& frm_nxt
                 return codecvt_base::error;
             *to_nxt = static_cast<uint16_t>(c1);
             ++frm_nxt;
+            if (Maxcode >= 0x7F)
+                to_nxt += widen_ascii(frm_nxt, frm_end, to_nxt + 1, to_end);
         }
         else if (c1 < 0xC2)
         {
@@ -2630,6 +2967,12 @@ utf8_to_ucs2_length(const uint8_t* frm, const uint8_t* frm_end,
             if (c1 > Maxcode)
                 break;
             ++frm_nxt;
+            if (Maxcode >= 0x7F)
+            {
+                size_t n = _VSTD::min(ascii_prefix_length(frm_nxt, frm_end), mx - nchar32_t - 1);
+                frm_nxt += n;
+                nchar32_t += n;
+            }
         }
         else if (c1 < 0xC2)
         {
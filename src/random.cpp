@@ -24,10 +24,20 @@
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(_LIBCPP_USING_DEV_RANDOM)
 #include <fcntl.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#if defined(SYS_getrandom)
+#define _LIBCPP_USING_GETRANDOM
+#endif
+#endif
+#if defined(_LIBCPP_ABI_RANDOM_DEVICE_BUFFER)
+#include <pthread.h>
+#endif
 #elif defined(_LIBCPP_USING_NACL_RANDOM)
 #include <nacl/nacl_random.h>
 #endif
@@ -53,43 +63,129 @@ random_device::operator()()
     return arc4random();
 }
 
+void
+random_device::__fill(void* __p, size_t __n)
+{
+    arc4random_buf(__p, __n);
+}
+
 #elif defined(_LIBCPP_USING_DEV_RANDOM)
 
+// Reads from the file descriptor __f, or from getrandom() if it is -1.
+static void
+__read_random(int __f, void* __p, size_t __n)
+{
+    char* __c = static_cast<char*>(__p);
+    while (__n > 0)
+    {
+#if defined(_LIBCPP_USING_GETRANDOM)
+        ssize_t __s = __f < 0 ? syscall(SYS_getrandom, __c, __n, 0)
+                              : read(__f, __c, __n);
+#else
+        ssize_t __s = read(__f, __c, __n);
+#endif
+        if (__s == 0)
+            __throw_system_error(ENODATA, "random_device got EOF");
+        if (__s == -1)
+        {
+            if (errno != EINTR)
+                __throw_system_error(errno, "random_device got an unexpected error");
+            continue;
+        }
+        __n -= static_cast<size_t>(__s);
+        __c += static_cast<size_t>(__s);
+    }
+}
+
+#if defined(_LIBCPP_USING_GETRANDOM)
+// getrandom() draws from the same pool as /dev/urandom without needing a
+// file descriptor, but kernels before 3.17 don't have it.
+static bool
+__have_getrandom()
+{
+    char __c;
+    return syscall(SYS_getrandom, &__c, 0, 0) == 0;
+}
+#endif
+
+#if defined(_LIBCPP_ABI_RANDOM_DEVICE_BUFFER)
+// Bumped in the child after a fork, so that parent and child never hand
+// out the same buffered values.
+static unsigned __fork_generation = 0;
+
+extern "C" {
+static void
+__random_device_after_fork()
+{
+    ++__fork_generation;
+}
+}
+#endif
+
 random_device::random_device(const string& __token)
-    : __f_(open(__token.c_str(), O_RDONLY))
 {
-    if (__f_ < 0)
-        __throw_system_error(errno, ("random_device failed to open " + __token).c_str());
+#if defined(_LIBCPP_USING_GETRANDOM)
+    if (__token == "/dev/urandom" && __have_getrandom())
+        __f_ = -1;
+    else
+#endif
+    {
+        __f_ = open(__token.c_str(), O_RDONLY);
+        if (__f_ < 0)
+            __throw_system_error(errno, ("random_device failed to open " + __token).c_str());
+    }
+#if defined(_LIBCPP_ABI_RANDOM_DEVICE_BUFFER)
+    static int __registered = pthread_atfork(0, 0, __random_device_after_fork);
+    (void)__registered;
+    __pos_ = 0;
+    __end_ = 0;
+    __gen_ = __fork_generation;
+#endif
 }
 
 random_device::~random_device()
 {
-    close(__f_);
+    if (__f_ >= 0)
+        close(__f_);
 }
 
+#if defined(_LIBCPP_ABI_RANDOM_DEVICE_BUFFER)
+
+// Each refill asks for twice as many words as the last one, up to the size
+// of the buffer, so that a random_device used for a single seed doesn't pay
+// for all of it.
 unsigned
 random_device::operator()()
 {
-    unsigned r;
-    size_t n = sizeof(r);
-    char* p = reinterpret_cast<char*>(&r);
-    while (n > 0)
+    if (__pos_ == __end_ || __gen_ != __fork_generation)
     {
-        ssize_t s = read(__f_, p, n);
-        if (s == 0)
-            __throw_system_error(ENODATA, "random_device got EOF");
-        if (s == -1)
-        {
-            if (errno != EINTR)
-                __throw_system_error(errno, "random_device got an unexpected error");
-            continue;
-        }
-        n -= static_cast<size_t>(s);
-        p += static_cast<size_t>(s);
+        size_t __n = __end_ == 0 ? 16 : _VSTD::min(2 * __end_, __buf_size);
+        __pos_ = __end_ = 0;
+        __read_random(__f_, __buf_, __n * sizeof(unsigned));
+        __end_ = __n;
+        __gen_ = __fork_generation;
     }
+    return __buf_[__pos_++];
+}
+
+#else  // defined(_LIBCPP_ABI_RANDOM_DEVICE_BUFFER)
+
+unsigned
+random_device::operator()()
+{
+    unsigned r;
+    __read_random(__f_, &r, sizeof(r));
     return r;
 }
 
+#endif  // defined(_LIBCPP_ABI_RANDOM_DEVICE_BUFFER)
+
+void
+random_device::__fill(void* __p, size_t __n)
+{
+    __read_random(__f_, __p, __n);
+}
+
 #elif defined(_LIBCPP_USING_NACL_RANDOM)
 
 random_device::random_device(const string& __token)
@@ -119,6 +215,21 @@ random_device::operator()()
     return r;
 }
 
+void
+random_device::__fill(void* __p, size_t __n)
+{
+    char* __c = static_cast<char*>(__p);
+    while (__n > 0)
+    {
+        size_t bytes_written;
+        int error = nacl_secure_random(__c, __n, &bytes_written);
+        if (error != 0)
+            __throw_system_error(error, "random_device failed getting bytes");
+        __n -= bytes_written;
+        __c += bytes_written;
+    }
+}
+
 #elif defined(_LIBCPP_USING_WIN32_RANDOM)
 
 random_device::random_device(const string& __token)
@@ -141,6 +252,22 @@ random_device::operator()()
     return r;
 }
 
+void
+random_device::__fill(void* __p, size_t __n)
+{
+    char* __c = static_cast<char*>(__p);
+    for (; __n >= sizeof(unsigned); __n -= sizeof(unsigned), __c += sizeof(unsigned))
+    {
+        unsigned r = (*this)();
+        memcpy(__c, &r, sizeof(r));
+    }
+    if (__n > 0)
+    {
+        unsigned r = (*this)();
+        memcpy(__c, &r, __n);
+    }
+}
+
 #else
 #error "Random device not implemented for this architecture"
 #endif
@@ -367,14 +367,14 @@ as_string(P sprintf_like, S s, const typename S::value_type* fmt, V a)
             size_type used = static_cast<size_type>(status);
             if ( used <= available )
             {
-                s.resize( used );
+                s.__resize_default_init( used );
                 break;
             }
             available = used; // Assume this is advice of how much space we need.
         }
         else
             available = available * 2 + 1;
-        s.resize(available);
+        s.__resize_default_init(available);
     }
     return s;
 }
@@ -389,7 +389,7 @@ struct initial_string<string, V, b>
     operator()() const
     {
         string s;
-        s.resize(s.capacity());
+        s.__resize_default_init(s.capacity());
         return s;
     }
 };
@@ -403,8 +403,9 @@ struct initial_string<wstring, V, false>
         const size_t n = (numeric_limits<unsigned long long>::digits / 3)
           + ((numeric_limits<unsigned long long>::digits % 3) != 0)
           + 1;
-        wstring s(n, wchar_t());
-        s.resize(s.capacity());
+        wstring s;
+        s.reserve(n);
+        s.__resize_default_init(s.capacity());
         return s;
     }
 };
@@ -415,8 +416,9 @@ struct initial_string<wstring, V, true>
     wstring
     operator()() const
     {
-        wstring s(20, wchar_t());
-        s.resize(s.capacity());
+        wstring s;
+        s.reserve(20);
+        s.__resize_default_init(s.capacity());
         return s;
     }
 };
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// Not a portable test
+
+// template <class _InputIterator>
+// void __tree::__insert_range_unique(_InputIterator __first, _InputIterator __last);
+// template <class _InputIterator>
+// void __tree::__insert_range_multi(_InputIterator __first, _InputIterator __last);
+
+// Sorted input builds a valid red-black tree directly; input that stops
+// being sorted part way through is inserted the usual way from there on.
+
+#include <__tree>
+#include <map>
+#include <set>
+#include <vector>
+#include <cassert>
+
+#include "test_iterators.h"
+
+typedef std::__tree<int, std::less<int>, std::allocator<int> > Tree;
+
+void check(const Tree& t, const std::vector<int>& expected)
+{
+    assert(t.size() == expected.size());
+    assert(t.__root() == 0 || std::__tree_invariant(t.__root()));
+    std::vector<int>::const_iterator j = expected.begin();
+    for (Tree::const_iterator i = t.begin(); i != t.end(); ++i, ++j)
+        assert(*i == *j);
+    assert(j == expected.end());
+}
+
+int main()
+{
+    for (int n = 0; n < 300; ++n)
+    {
+        std::vector<int> v;
+        for (int i = 0; i < n; ++i)
+            v.push_back(2 * i);
+        {
+            Tree t((std::less<int>()));
+            t.__insert_range_unique(v.begin(), v.end());
+            check(t, v);
+            for (int i = 0; i < n; ++i)
+                t.__insert_unique(2 * i + 1);
+            assert(std::__tree_invariant(t.__root()) || n == 0);
+            assert(static_cast<const Tree&>(t).size() == 2 * static_cast<std::size_t>(n));
+        }
+        {
+            Tree t((std::less<int>()));
+            t.__insert_range_multi(input_iterator<const int*>(v.data()),
+                                   input_iterator<const int*>(v.data() + n));
+            check(t, v);
+        }
+    }
+    {
+        // Out of order, and duplicates.
+        int a[] = {1, 3, 5, 7, 4, 2, 8, 8, 0, 9};
+        Tree t((std::less<int>()));
+        t.__insert_range_unique(a, a + 10);
+        int u[] = {0, 1, 2, 3, 4, 5, 7, 8, 9};
+        check(t, std::vector<int>(u, u + 9));
+
+        Tree m((std::less<int>()));
+        m.__insert_range_multi(a, a + 10);
+        int s[] = {0, 1, 2, 3, 4, 5, 7, 8, 8, 9};
+        check(m, std::vector<int>(s, s + 10));
+
+        int d[] = {1, 1, 2, 2, 3};
+        Tree r((std::less<int>()));
+        r.__insert_range_unique(d, d + 5);
+        int e[] = {1, 2, 3};
+        check(r, std::vector<int>(e, e + 3));
+        r.__insert_range_unique(a, a + 10);
+        check(r, std::vector<int>(u, u + 9));
+    }
+    {
+        // Equal keys keep their order in a multimap, and the first one wins
+        // in a map.
+        typedef std::pair<int, int> P;
+        P a[] = {P(1, 0), P(2, 1), P(2, 2), P(2, 3), P(3, 4), P(1, 5)};
+        std::multimap<int, int> mm(a, a + 6);
+        assert(mm.size() == 6);
+        std::multimap<int, int>::iterator i = mm.begin();
+        assert(i->second == 0);
+        assert((++i)->second == 5);
+        assert((++i)->second == 1);
+        assert((++i)->second == 2);
+        assert((++i)->second == 3);
+        std::map<int, int> m(a, a + 6);
+        assert(m.size() == 3);
+        assert(m[2] == 1);
+        std::set<int> s;
+        s.insert(1);
+        int b[] = {0, 2};
+        s.insert(b, b + 2);
+        assert(s.size() == 3);
+        std::multiset<int> ms(b, b + 2);
+        std::multiset<int> copy(ms);
+        assert(copy == ms);
+    }
+}
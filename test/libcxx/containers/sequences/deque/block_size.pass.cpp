@@ -0,0 +1,161 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <deque>
+
+// __libcpp_deque_block_size may be specialized to choose the number of
+// elements in each block of a deque.  Deques with small, odd and large
+// blocks behave like a vector holding the same values.
+
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+template <std::size_t N>
+struct Elem
+{
+    int value;
+    char pad[N];
+
+    Elem() : value(0) {}
+    Elem(int v) : value(v) {}
+    friend bool operator==(const Elem& x, const Elem& y) {return x.value == y.value;}
+    friend bool operator<(const Elem& x, const Elem& y) {return x.value < y.value;}
+};
+
+typedef Elem<1> Small;
+typedef Elem<3> Odd;
+typedef Elem<508> Large;
+
+namespace std {
+template <> struct __libcpp_deque_block_size<Small> : integral_constant<size_t, 2> {};
+template <> struct __libcpp_deque_block_size<Odd> : integral_constant<size_t, 3> {};
+template <> struct __libcpp_deque_block_size<Large> : integral_constant<size_t, 64> {};
+}
+
+// Other types keep the default sizes.
+static_assert(std::__deque_block_size<int, std::ptrdiff_t>::value == 4096 / sizeof(int), "");
+static_assert(std::__deque_block_size<Elem<4>, std::ptrdiff_t>::value == 4096 / sizeof(Elem<4>), "");
+static_assert(std::__deque_block_size<Elem<512>, std::ptrdiff_t>::value == 16, "");
+
+std::size_t block_allocation = 0;
+
+// Records the size of the last block allocated.  The map of block pointers
+// uses a rebound copy, which is not recorded.
+template <class T>
+struct recording_allocator
+{
+    typedef T value_type;
+
+    recording_allocator() {}
+    template <class U> recording_allocator(const recording_allocator<U>&) {}
+
+    T* allocate(std::size_t n)
+    {
+        if (!std::is_pointer<T>::value)
+            block_allocation = n;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) {std::allocator<T>().deallocate(p, n);}
+};
+
+template <class T, class U>
+bool operator==(const recording_allocator<T>&, const recording_allocator<U>&) {return true;}
+template <class T, class U>
+bool operator!=(const recording_allocator<T>&, const recording_allocator<U>&) {return false;}
+
+template <class D, class V>
+void check(const D& d, const V& v)
+{
+    assert(d.size() == v.size());
+    assert(std::equal(d.begin(), d.end(), v.begin()));
+    assert(std::equal(d.rbegin(), d.rend(), v.rbegin()));
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        assert(d[i] == v[i]);
+        assert(d.begin() + i == d.end() - (v.size() - i));
+        assert((d.end() - (d.begin() + i)) == static_cast<std::ptrdiff_t>(v.size() - i));
+    }
+}
+
+template <class T, std::size_t BlockSize>
+void test()
+{
+    typedef std::deque<T, recording_allocator<T> > D;
+    std::vector<T> v;
+    D d;
+    for (int i = 0; i < 200; ++i)
+    {
+        d.push_back(T(i));
+        v.push_back(T(i));
+        d.push_front(T(-i));
+        v.insert(v.begin(), T(-i));
+    }
+    assert(block_allocation == BlockSize);
+    check(d, v);
+
+    for (int i = 0; i < 50; ++i)
+    {
+        std::size_t pos = (i * 37) % v.size();
+        d.insert(d.begin() + pos, T(1000 + i));
+        v.insert(v.begin() + pos, T(1000 + i));
+        pos = (i * 53) % v.size();
+        d.erase(d.begin() + pos);
+        v.erase(v.begin() + pos);
+    }
+    check(d, v);
+
+    d.erase(d.begin() + 10, d.begin() + 150);
+    v.erase(v.begin() + 10, v.begin() + 150);
+    d.insert(d.begin() + 100, 70, T(7));
+    v.insert(v.begin() + 100, 70, T(7));
+    check(d, v);
+
+    for (int i = 0; i < 90; ++i)
+    {
+        d.pop_front();
+        v.erase(v.begin());
+        d.pop_back();
+        v.pop_back();
+    }
+    d.shrink_to_fit();
+    check(d, v);
+
+    std::fill(d.begin() + 1, d.end() - 1, T(5));
+    std::fill(v.begin() + 1, v.end() - 1, T(5));
+    check(d, v);
+    std::sort(d.begin(), d.end());
+    std::sort(v.begin(), v.end());
+    check(d, v);
+    assert(std::find(d.begin(), d.end(), T(5)) - d.begin() ==
+           std::find(v.begin(), v.end(), T(5)) - v.begin());
+
+    D c(d);
+    check(c, v);
+    d.resize(1000, T(3));
+    v.resize(1000, T(3));
+    check(d, v);
+    c.assign(v.begin(), v.end());
+    check(c, v);
+    d.clear();
+    assert(d.empty() && d.begin() == d.end());
+}
+
+int main()
+{
+    test<Small, 2>();
+    test<Odd, 3>();
+    test<Large, 64>();
+}
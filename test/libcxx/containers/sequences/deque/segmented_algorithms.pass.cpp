@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <deque>
+
+// fill, find and for_each work a block at a time on deque iterators, and
+// __libcpp_deque_block_size may be specialized for a value type.
+
+#include <deque>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+struct Big
+{
+    char c[512];
+};
+
+namespace std {
+template <>
+struct __libcpp_deque_block_size<Big> : integral_constant<size_t, 64> {};
+}
+
+struct Sum
+{
+    long sum;
+    long calls;
+    Sum() : sum(0), calls(0) {}
+    void operator()(int i) {sum += i; ++calls;}
+};
+
+void test(std::deque<int>& d)
+{
+    typedef std::deque<int>::iterator I;
+    typedef std::deque<int>::const_iterator CI;
+    const int n = static_cast<int>(d.size());
+    for (int i = 0; i < n; ++i)
+        d[i] = i;
+
+    const std::deque<int>& cd = d;
+    for (int f = 0; f < n; f += 97)
+        for (int l = f; l <= n; l += 211)
+        {
+            CI first = cd.begin() + f;
+            CI last = cd.begin() + l;
+            for (int v = f - 1; v <= l; v += 53)
+                assert(std::find(first, last, v) == (f <= v && v < l ? first + (v - f) : last));
+            assert(std::find(first, last, l - 1) == (f < l ? last - 1 : last));
+
+            Sum s = std::for_each(first, last, Sum());
+            assert(s.calls == l - f);
+            assert(s.sum == (static_cast<long>(l) * (l - 1) - static_cast<long>(f) * (f - 1)) / 2);
+        }
+
+    I first = d.begin() + n / 3;
+    I last = d.end() - n / 3;
+    std::fill(first, last, -1);
+    for (int i = 0; i < n; ++i)
+        assert(d[i] == (i < n / 3 || i >= n - n / 3 ? i : -1));
+}
+
+int main()
+{
+    {
+        std::deque<int> d;
+        test(d);
+        d.resize(1);
+        test(d);
+        d.resize(5000);
+        test(d);
+        for (int i = 0; i < 700; ++i)
+            d.push_front(0);
+        test(d);
+        d.erase(d.begin(), d.begin() + 1500);
+        test(d);
+    }
+    {
+        std::deque<Big> d(640);
+        std::size_t breaks = 0;
+        for (std::size_t i = 1; i < d.size(); ++i)
+            if (&d[i] != &d[i - 1] + 1)
+                ++breaks;
+        assert(breaks <= 10);
+        Big b;
+        std::fill(b.c, b.c + sizeof(b.c), 'x');
+        std::fill(d.begin() + 1, d.end() - 1, b);
+        assert(d.front().c[0] != 'x' && d[1].c[0] == 'x' && d[638].c[511] == 'x');
+    }
+}
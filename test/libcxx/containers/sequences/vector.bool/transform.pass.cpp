@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <vector>
+
+// vector<bool>
+
+// transform() with the bitwise and logical function objects works a word
+// at a time.  Check it against a loop over the bits for every alignment of
+// the inputs and the output, and check _Find_first() and _Find_next().
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cassert>
+
+#include "test_macros.h"
+
+std::vector<bool> make(std::size_t n, unsigned seed)
+{
+    std::vector<bool> v(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        v[i] = (seed >> 16) & 1;
+    }
+    return v;
+}
+
+template <class Op>
+void test_binary(Op op)
+{
+    const std::vector<bool> a = make(300, 1);
+    const std::vector<bool> b = make(300, 2);
+    for (std::size_t n = 0; n < 200; n += 13)
+    for (std::size_t i = 0; i < 70; i += 3)
+    for (std::size_t j = 0; j < 70; j += 5)
+    for (std::size_t k = 0; k < 70; k += 7)
+    {
+        std::vector<bool> r = make(300, 3);
+        std::vector<bool> e = r;
+        for (std::size_t m = 0; m < n; ++m)
+            e[k + m] = op(a[i + m], b[j + m]);
+        std::vector<bool>::iterator it =
+            std::transform(a.begin() + i, a.begin() + (i + n), b.begin() + j, r.begin() + k, op);
+        assert(it == r.begin() + (k + n));
+        assert(r == e);
+    }
+}
+
+template <class Op>
+void test_unary(Op op)
+{
+    const std::vector<bool> a = make(300, 4);
+    for (std::size_t n = 0; n < 200; n += 11)
+    for (std::size_t i = 0; i < 70; ++i)
+    for (std::size_t k = 0; k < 70; k += 3)
+    {
+        std::vector<bool> r = make(300, 5);
+        std::vector<bool> e = r;
+        for (std::size_t m = 0; m < n; ++m)
+            e[k + m] = op(a[i + m]);
+        std::vector<bool>::iterator it =
+            std::transform(a.begin() + i, a.begin() + (i + n), r.begin() + k, op);
+        assert(it == r.begin() + (k + n));
+        assert(r == e);
+    }
+}
+
+void test_find()
+{
+    std::vector<bool> v(200);
+    assert(v._Find_first() == 200);
+    v[3] = v[64] = v[65] = v[199] = true;
+    assert(v._Find_first() == 3);
+    assert(v._Find_next(3) == 64);
+    assert(v._Find_next(64) == 65);
+    assert(v._Find_next(65) == 199);
+    assert(v._Find_next(199) == 200);
+    assert(v._Find_next(1000) == 200);
+    std::vector<bool> e;
+    assert(e._Find_first() == 0);
+    assert(e._Find_next(0) == 0);
+}
+
+int main()
+{
+    test_binary(std::bit_and<bool>());
+    test_binary(std::bit_or<bool>());
+    test_binary(std::bit_xor<bool>());
+    test_binary(std::logical_and<bool>());
+    test_binary(std::logical_or<bool>());
+    test_binary(std::equal_to<bool>());
+    test_binary(std::not_equal_to<bool>());
+    test_unary(std::logical_not<bool>());
+#if TEST_STD_VER > 11
+    test_binary(std::bit_and<>());
+    test_binary(std::equal_to<>());
+    test_unary(std::logical_not<>());
+#endif
+
+    // In place.
+    {
+        std::vector<bool> a = make(1000, 6);
+        const std::vector<bool> b = make(1000, 7);
+        std::vector<bool> e = a;
+        for (std::size_t m = 0; m < e.size(); ++m)
+            e[m] = e[m] ^ b[m];
+        std::transform(a.begin(), a.end(), b.begin(), a.begin(), std::bit_xor<bool>());
+        assert(a == e);
+        std::transform(a.begin(), a.end(), a.begin(), std::logical_not<bool>());
+        e.flip();
+        assert(a == e);
+    }
+
+    test_find();
+}
@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <vector>
+
+// void __resize_default_init(size_type sz); // libc++ extension
+
+// Leaves the added elements uninitialized if value_type is trivially default
+// constructible and the allocator does not customize construct.  Otherwise
+// behaves like resize(sz).
+
+#include <vector>
+#include <cassert>
+
+#include "test_allocator.h"
+
+int constructed = 0;
+
+struct NonTrivial
+{
+    int value;
+    NonTrivial() : value(42) {++constructed;}
+};
+
+template <class T>
+struct construct_allocator
+    : public std::allocator<T>
+{
+    template <class U> struct rebind {typedef construct_allocator<U> other;};
+    construct_allocator() {}
+    template <class U> construct_allocator(const construct_allocator<U>&) {}
+    template <class U>
+    void construct(U* p) {::new ((void*)p) U(); ++constructed;}
+};
+
+int main()
+{
+    {
+        std::vector<unsigned char> v;
+        v.reserve(100);
+        v.assign(100, 7);
+        v.__resize_default_init(10);
+        assert(v.size() == 10);
+        v.__resize_default_init(100);
+        assert(v.size() == 100);
+        for (int i = 0; i < 100; ++i)
+            assert(v[i] == 7);
+
+        v.__resize_default_init(1000);
+        assert(v.size() == 1000);
+        for (int i = 0; i < 100; ++i)
+            assert(v[i] == 7);
+        v.__resize_default_init(5);
+        assert(v.size() == 5);
+    }
+    {
+        std::vector<NonTrivial> v(3);
+        constructed = 0;
+        v.__resize_default_init(50);
+        assert(constructed == 47);
+        for (int i = 0; i < 50; ++i)
+            assert(v[i].value == 42);
+    }
+    {
+        std::vector<int, construct_allocator<int> > v;
+        constructed = 0;
+        v.__resize_default_init(20);
+        assert(constructed == 20);
+        for (int i = 0; i < 20; ++i)
+            assert(v[i] == 0);
+    }
+}
@@ -0,0 +1,258 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+// UNSUPPORTED: libcpp-no-exceptions
+
+// <vector>
+
+// vector moves trivially relocatable elements with memcpy when it grows,
+// instead of moving and destroying them one by one.  insert and erase shift
+// the tail with memmove only when the elements are also trivially shiftable,
+// that is, trivially move assignable or one of the library's own types.
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <cassert>
+
+int moves = 0;
+int live = 0;
+
+// Counts its moves; opts in to relocation.
+struct R
+{
+    int value;
+
+    R(int v) : value(v) {++live;}
+    R(const R& r) : value(r.value) {++live;}
+    R(R&& r) : value(r.value) {++moves; ++live;}
+    R& operator=(const R& r) {value = r.value; return *this;}
+    R& operator=(R&& r) {++moves; value = r.value; return *this;}
+    ~R() {--live;}
+};
+
+namespace std {
+template <>
+struct __libcpp_is_trivially_relocatable<R> : true_type {};
+}
+
+// Trivially relocatable and trivially move assignable, but its copy
+// constructor may throw.
+struct T
+{
+    int value;
+    bool throws;
+
+    T(int v, bool t = false) : value(v), throws(t) {}
+    T(const T& t) : value(t.value), throws(t.throws)
+    {
+        if (throws)
+            throw 0;
+    }
+    T(T&&) = default;
+    T& operator=(const T&) = default;
+    T& operator=(T&&) = default;
+};
+
+int assigns = 0;
+
+// Trivially relocatable without opting in, but its assignment is
+// user-written, so insert and erase must still call it.
+struct A
+{
+    int value;
+
+    A(int v) : value(v) {}
+    A(const A&) = default;
+    A& operator=(const A& a) {++assigns; value = a.value; return *this;}
+};
+
+// Does not opt in.
+struct N
+{
+    ~N() {}
+};
+
+// Opts in but is constructed by its allocator.
+template <class T>
+struct constructing_allocator : std::allocator<T>
+{
+    typedef T value_type;
+    template <class U> struct rebind {typedef constructing_allocator<U> other;};
+    constructing_allocator() {}
+    template <class U> constructing_allocator(const constructing_allocator<U>&) {}
+    template <class U, class... Args>
+    void construct(U* p, Args&&... args) {::new ((void*)p) U(std::forward<Args>(args)...);}
+};
+
+static_assert(std::__libcpp_is_trivially_relocatable<int>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::string>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::unique_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::unique_ptr<int[]> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::shared_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::weak_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::vector<std::string> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<T>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<A>::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<N>::value, "");
+static_assert(std::__allocator_can_relocate<std::allocator<R>, R>::value, "");
+static_assert(!std::__allocator_can_relocate<constructing_allocator<R>, R>::value, "");
+
+// Counts its assignments.
+struct counting_deleter
+{
+    counting_deleter() {}
+    counting_deleter(const counting_deleter&) = default;
+    counting_deleter& operator=(const counting_deleter&) {++assigns; return *this;}
+    void operator()(int* p) const {delete p;}
+};
+
+static_assert(std::__libcpp_is_trivially_shiftable<int>::value, "");
+static_assert(std::__libcpp_is_trivially_shiftable<T>::value, "");
+static_assert(std::__libcpp_is_trivially_shiftable<std::string>::value, "");
+static_assert(std::__libcpp_is_trivially_shiftable<std::unique_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_shiftable<std::unique_ptr<int[]> >::value, "");
+static_assert(std::__libcpp_is_trivially_shiftable<std::shared_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_shiftable<std::weak_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_shiftable<std::vector<std::string> >::value, "");
+static_assert(!std::__libcpp_is_trivially_shiftable<R>::value, "");
+static_assert(!std::__libcpp_is_trivially_shiftable<A>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::unique_ptr<int, counting_deleter> >::value, "");
+static_assert(!std::__libcpp_is_trivially_shiftable<std::unique_ptr<int, counting_deleter> >::value, "");
+static_assert(std::__allocator_can_shift<std::allocator<std::string>, std::string>::value, "");
+static_assert(!std::__allocator_can_shift<std::allocator<R>, R>::value, "");
+
+void check(const std::vector<R>& v, int first, int n)
+{
+    assert(v.size() == static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i)
+        assert(v[i].value == first + i);
+    assert(live == n);
+}
+
+int main()
+{
+    {
+        std::vector<R> v;
+        for (int i = 0; i < 100; ++i)
+            v.push_back(R(i));
+        moves = 0;
+        v.shrink_to_fit();
+        v.reserve(1000);
+        assert(moves == 0);
+        check(v, 0, 100);
+
+        // Insert and erase in the middle, with and without room.  R's
+        // assignment is not trivial, so the tail is shifted by assignment.
+        v.insert(v.begin() + 50, R(-1));
+        v.erase(v.begin() + 50);
+        v.shrink_to_fit();
+        v.insert(v.begin() + 50, R(-1));
+        v.erase(v.begin() + 50);
+        v.emplace(v.begin() + 10, -1);
+        v.erase(v.begin() + 10, v.begin() + 11);
+        v.insert(v.begin() + 10, v[90]);
+        assert(v[10].value == 90 && v[91].value == 90);
+        v.erase(v.begin() + 10);
+        v.erase(v.begin(), v.begin() + 20);
+        check(v, 20, 80);
+    }
+    assert(live == 0);
+    {
+        std::vector<R, constructing_allocator<R> > v;
+        for (int i = 0; i < 10; ++i)
+            v.push_back(R(i));
+        moves = 0;
+        v.erase(v.begin());
+        assert(moves == 9);
+    }
+    {
+        // A throwing copy leaves the vector as it was.
+        std::vector<T> v;
+        v.reserve(20);
+        for (int i = 0; i < 10; ++i)
+            v.push_back(T(i));
+        try
+        {
+            T t(-1, true);
+            v.insert(v.begin() + 5, t);
+            assert(false);
+        }
+        catch (int) {}
+        assert(v.size() == 10);
+        for (int i = 0; i < 10; ++i)
+            assert(v[i].value == i);
+    }
+    {
+        std::vector<A> v;
+        v.reserve(20);
+        for (int i = 0; i < 10; ++i)
+            v.push_back(A(i));
+        assigns = 0;
+        v.erase(v.begin());
+        assert(assigns == 9);
+        v.insert(v.begin(), A(0));
+        assert(assigns == 18);
+        v.erase(v.begin() + 2, v.begin() + 4);
+        assert(assigns == 24);
+        assert(v.size() == 8);
+        assert(v[0].value == 0 && v[1].value == 1 && v[2].value == 4);
+        assert(v[7].value == 9);
+    }
+    {
+        std::vector<std::string> v;
+        for (int i = 0; i < 1000; ++i)
+            v.push_back(std::string(i % 40, 'a' + i % 26));
+        v.insert(v.begin() + 500, std::string(100, 'x'));
+        v.erase(v.begin() + 100, v.begin() + 200);
+        assert(v.size() == 901);
+        assert(v[400] == std::string(100, 'x'));
+        for (int i = 0; i < 100; ++i)
+            assert(v[i] == std::string(i % 40, 'a' + i % 26));
+        for (int i = 401; i < 901; ++i)
+            assert(v[i] == std::string((i + 99) % 40, 'a' + (i + 99) % 26));
+    }
+    {
+        std::vector<std::unique_ptr<int> > v;
+        for (int i = 0; i < 100; ++i)
+            v.push_back(std::unique_ptr<int>(new int(i)));
+        v.erase(v.begin());
+        v.insert(v.begin(), std::unique_ptr<int>(new int(0)));
+        for (int i = 0; i < 100; ++i)
+            assert(*v[i] == i);
+    }
+    {
+        std::vector<std::shared_ptr<int> > v;
+        std::shared_ptr<int> p(new int(-1));
+        for (int i = 0; i < 10; ++i)
+            v.push_back(std::make_shared<int>(i));
+        v.insert(v.begin() + 5, p);
+        v.insert(v.begin() + 5, std::move(p));
+        assert(v[5].use_count() == 2);
+        v.erase(v.begin() + 5);
+        assert(v[5].use_count() == 1);
+        v.erase(v.begin() + 5);
+        for (int i = 0; i < 10; ++i)
+            assert(*v[i] == i && v[i].use_count() == 1);
+    }
+    {
+        // A deleter with a user-written assignment keeps unique_ptr on the
+        // assignment path.
+        std::vector<std::unique_ptr<int, counting_deleter> > v;
+        v.reserve(20);
+        for (int i = 0; i < 10; ++i)
+            v.push_back(std::unique_ptr<int, counting_deleter>(new int(i)));
+        assigns = 0;
+        v.erase(v.begin());
+        assert(assigns == 9);
+        for (int i = 0; i < 9; ++i)
+            assert(*v[i] == i + 1);
+    }
+}
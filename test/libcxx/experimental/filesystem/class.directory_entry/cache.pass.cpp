@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <experimental/filesystem>
+
+// class directory_entry
+
+// Extensions:
+// void refresh();
+// void refresh(error_code&) noexcept;
+// bool exists() const;
+// bool is_directory() const;
+// bool is_regular_file() const;
+// bool is_symlink() const;
+// ...
+
+// Entries from a directory iterator know their type, and refresh() stores
+// the results of status() and symlink_status() until the entry changes.
+
+#include <experimental/filesystem>
+#include <cassert>
+
+#include "filesystem_test_helper.hpp"
+
+using namespace fs;
+
+void check_same_as_path(const directory_entry& e)
+{
+  const path& p = e.path();
+  std::error_code ec, pec;
+  assert(e.exists() == fs::exists(p));
+  assert(e.is_block_file() == fs::is_block_file(p));
+  assert(e.is_character_file() == fs::is_character_file(p));
+  assert(e.is_directory() == fs::is_directory(p));
+  assert(e.is_fifo() == fs::is_fifo(p));
+  assert(e.is_other() == fs::is_other(p));
+  assert(e.is_regular_file() == fs::is_regular_file(p));
+  assert(e.is_socket() == fs::is_socket(p));
+  assert(e.is_symlink() == fs::is_symlink(p));
+  assert(e.is_directory(ec) == fs::is_directory(p, pec) && ec == pec);
+  assert(e.exists(ec) == fs::exists(p, pec) && ec == pec);
+  assert(e.status().type() == fs::status(p).type());
+  assert(e.status().permissions() == fs::status(p).permissions());
+  assert(e.symlink_status().type() == fs::symlink_status(p).type());
+  assert(e.symlink_status().permissions() == fs::symlink_status(p).permissions());
+}
+
+void test_iterated_entries()
+{
+  const path dirs[] = {StaticEnv::Root, StaticEnv::Dir, StaticEnv::Dir2};
+  for (const path& d : dirs) {
+    for (const directory_entry& e : directory_iterator(d)) {
+      check_same_as_path(e);
+      directory_entry copy(e);
+      copy.refresh();
+      check_same_as_path(copy);
+    }
+  }
+  int n = 0;
+  for (const directory_entry& e : recursive_directory_iterator(StaticEnv::Root)) {
+    check_same_as_path(e);
+    ++n;
+  }
+  assert(n > 0);
+}
+
+void test_refresh()
+{
+  scoped_test_env env;
+  const path file = env.create_file("file", 42);
+  const path dir = env.create_dir("dir");
+  const path sym = env.create_symlink(dir, "sym");
+  const path bad = env.create_symlink("dne", "bad_sym");
+  {
+    directory_entry e(file);
+    e.refresh();
+    check_same_as_path(e);
+    const file_status st = fs::status(file);
+    fs::remove(file);
+    assert(e.exists());
+    assert(e.is_regular_file());
+    assert(e.status().type() == st.type());
+    assert(e.status().permissions() == st.permissions());
+    std::error_code ec = std::make_error_code(std::errc::address_in_use);
+    assert(e.status(ec).type() == file_type::regular);
+    assert(!ec);
+    // A file that does not exist is not an error for refresh().
+    ec = std::make_error_code(std::errc::address_in_use);
+    e.refresh(ec);
+    assert(!ec);
+    e.refresh();
+    assert(!e.exists());
+    assert(e.status(ec).type() == file_type::not_found);
+    assert(ec);
+    assert(!e.exists(ec));
+    assert(!ec);
+  }
+  {
+    directory_entry e(sym);
+    e.refresh();
+    check_same_as_path(e);
+    assert(e.is_symlink() && e.is_directory());
+    e.assign(file);
+    assert(!e.exists());
+    e.replace_filename("dir");
+    assert(!e.is_symlink() && e.is_directory());
+  }
+  {
+    directory_entry e(bad);
+    std::error_code ec;
+    e.refresh(ec);
+    assert(!ec);
+    assert(e.is_symlink());
+    assert(!e.exists());
+    assert(e.symlink_status().type() == file_type::symlink);
+    assert(e.status(ec).type() == file_type::not_found);
+    assert(ec);
+  }
+}
+
+int main()
+{
+  test_iterated_entries();
+  test_refresh();
+}
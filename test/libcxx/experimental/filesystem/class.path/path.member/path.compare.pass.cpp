@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <experimental/filesystem>
+
+// class path
+
+// int compare(path const&) const noexcept;
+
+// compare() skips the elements in the common prefix of the two strings.
+// Check it against comparing the elements one by one for every pair of
+// paths built from a small alphabet, so that separators, root names and
+// trailing separators line up with the first difference in every way.
+
+#include <experimental/filesystem>
+#include <string>
+#include <vector>
+#include <cassert>
+
+namespace fs = std::experimental::filesystem;
+
+int sign(int x) { return (x > 0) - (x < 0); }
+
+int compare_elements(const fs::path& x, const fs::path& y)
+{
+    auto i = x.begin(), j = y.begin();
+    for (; i != x.end() && j != y.end(); ++i, ++j)
+        if (int r = i->native().compare(j->native()))
+            return sign(r);
+    if (i == x.end() && j == y.end())
+        return 0;
+    return i == x.end() ? -1 : 1;
+}
+
+void generate(std::vector<std::string>& out, std::string s, int len)
+{
+    out.push_back(s);
+    if (len == 0)
+        return;
+    for (const char* c : {"/", "a", "b", "."})
+        generate(out, s + c, len - 1);
+}
+
+int main()
+{
+    std::vector<std::string> strs;
+    generate(strs, "", 5);
+    for (const auto& x : strs)
+    {
+        const fs::path px(x);
+        for (const auto& y : strs)
+        {
+            const fs::path py(y);
+            assert(sign(px.compare(py)) == compare_elements(px, py));
+        }
+    }
+}
@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <experimental/filesystem>
+
+// Extension:
+// void parallel_copy(const path& from, const path& to, copy_options options);
+// void parallel_copy(const path& from, const path& to, copy_options options,
+//                    error_code& ec) noexcept;
+
+#include <experimental/filesystem>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_macros.h"
+#include "rapid-cxx-test.hpp"
+#include "filesystem_test_helper.hpp"
+
+using namespace std::experimental::filesystem;
+namespace fs = std::experimental::filesystem;
+
+using CO = fs::copy_options;
+
+// Makes a tree with Fanout subdirectories and Fanout files in each directory
+// down to Depth levels.
+void make_tree(path const& dir, int Depth, int Fanout)
+{
+    for (int i = 0; i < Fanout; ++i) {
+        std::ofstream((dir / ("file" + std::to_string(i))).c_str())
+            << std::string(i * 10, 'a');
+        if (Depth > 1) {
+            const path sub = dir / ("dir" + std::to_string(i));
+            create_directory(sub);
+            make_tree(sub, Depth - 1, Fanout);
+        }
+    }
+}
+
+// The relative paths under dir, each with its file type and size.
+typedef std::vector<std::pair<std::string, std::uintmax_t> > Listing;
+
+Listing list_tree(path const& dir)
+{
+    Listing out;
+    const std::size_t prefix = dir.native().size();
+    for (recursive_directory_iterator it(dir), end; it != end; ++it) {
+        const file_status st = it->symlink_status();
+        out.push_back(std::make_pair(it->path().native().substr(prefix),
+            is_regular_file(st) ? file_size(it->path())
+                                : static_cast<std::uintmax_t>(st.type())));
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+TEST_SUITE(filesystem_parallel_copy_test_suite)
+
+TEST_CASE(signature_test)
+{
+    const path p; ((void)p);
+    std::error_code ec; ((void)ec);
+    const copy_options opts{}; ((void)opts);
+    ASSERT_NOT_NOEXCEPT(fs::parallel_copy(p, p, opts));
+    ASSERT_NOEXCEPT(fs::parallel_copy(p, p, opts, ec));
+}
+
+TEST_CASE(test_error_reporting)
+{
+    auto checkThrow = [](path const& f, path const& t, const std::error_code& ec)
+    {
+#ifndef TEST_HAS_NO_EXCEPTIONS
+        try {
+            fs::parallel_copy(f, t, CO::recursive);
+            return false;
+        } catch (filesystem_error const& err) {
+            return err.path1() == f
+                && err.path2() == t
+                && err.code() == ec;
+        }
+#else
+        ((void)f); ((void)t); ((void)ec);
+        return true;
+#endif
+    };
+    scoped_test_env env;
+    const path dne = env.make_env_path("dne");
+    const path dir = env.create_dir("dir");
+    make_tree(dir, 2, 3);
+    const path bad_perms_dir = env.create_dir("dir/dir1/bad_dir");
+    env.create_file(bad_perms_dir / "file", 42);
+    permissions(bad_perms_dir, perms::none);
+    {
+        const path to = env.make_env_path("to1");
+        std::error_code ec;
+        fs::parallel_copy(dne, to, CO::recursive, ec);
+        TEST_CHECK(ec);
+        TEST_CHECK(checkThrow(dne, to, ec));
+    }
+    {
+        const path to = env.make_env_path("to2");
+        std::error_code ec;
+        fs::parallel_copy(dir, to, CO::recursive, ec);
+        TEST_CHECK(ec);
+        TEST_CHECK(is_directory(to));
+    }
+    permissions(bad_perms_dir, perms::all);
+}
+
+TEST_CASE(same_as_copy)
+{
+    scoped_test_env env;
+    const path dir = env.create_dir("dir");
+    make_tree(dir, 4, 4);
+    create_symlink("file1", dir / "dir2/sym_to_file");
+    create_directory_symlink(dir / "dir3", dir / "dir1/sym_to_dir");
+    const CO options[] = {
+        CO::none, CO::recursive, CO::recursive | CO::copy_symlinks,
+        CO::recursive | CO::skip_symlinks,
+        CO::recursive | CO::directories_only
+    };
+    int n = 0;
+    for (CO opt : options) {
+        const path seq = env.make_env_path("seq" + std::to_string(n));
+        const path par = env.make_env_path("par" + std::to_string(n));
+        ++n;
+        fs::copy(dir, seq, opt);
+        std::error_code ec = std::make_error_code(std::errc::address_in_use);
+        fs::parallel_copy(dir, par, opt, ec);
+        TEST_REQUIRE(!ec);
+        TEST_CHECK(list_tree(par) == list_tree(seq));
+    }
+    {
+        const path file = dir / "file2";
+        const path to = env.make_env_path("file_copy");
+        std::error_code ec = std::make_error_code(std::errc::address_in_use);
+        fs::parallel_copy(file, to, CO::recursive, ec);
+        TEST_REQUIRE(!ec);
+        TEST_CHECK(file_size(to) == file_size(file));
+    }
+}
+
+TEST_SUITE_END()
@@ -0,0 +1,150 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <experimental/filesystem>
+
+// Extension:
+// uintmax_t parallel_remove_all(const path& p);
+// uintmax_t parallel_remove_all(const path& p, error_code& ec) noexcept;
+
+#include <experimental/filesystem>
+#include <fstream>
+#include <string>
+
+#include "test_macros.h"
+#include "rapid-cxx-test.hpp"
+#include "filesystem_test_helper.hpp"
+
+using namespace std::experimental::filesystem;
+namespace fs = std::experimental::filesystem;
+
+// Makes a tree with Fanout subdirectories and Fanout files in each directory
+// down to Depth levels, and returns the number of entries in it.
+std::uintmax_t make_tree(path const& dir, int Depth, int Fanout)
+{
+    std::uintmax_t count = 0;
+    for (int i = 0; i < Fanout; ++i) {
+        std::ofstream((dir / ("file" + std::to_string(i))).c_str()) << i;
+        ++count;
+        if (Depth > 1) {
+            const path sub = dir / ("dir" + std::to_string(i));
+            create_directory(sub);
+            count += 1 + make_tree(sub, Depth - 1, Fanout);
+        }
+    }
+    return count;
+}
+
+TEST_SUITE(filesystem_parallel_remove_all_test_suite)
+
+TEST_CASE(test_signatures)
+{
+    const path p; ((void)p);
+    std::error_code ec; ((void)ec);
+    ASSERT_SAME_TYPE(decltype(fs::parallel_remove_all(p)), std::uintmax_t);
+    ASSERT_SAME_TYPE(decltype(fs::parallel_remove_all(p, ec)), std::uintmax_t);
+
+    ASSERT_NOT_NOEXCEPT(fs::parallel_remove_all(p));
+    ASSERT_NOEXCEPT(fs::parallel_remove_all(p, ec));
+}
+
+TEST_CASE(test_error_reporting)
+{
+    auto checkThrow = [](path const& f, const std::error_code& ec)
+    {
+#ifndef TEST_HAS_NO_EXCEPTIONS
+        try {
+            fs::parallel_remove_all(f);
+            return false;
+        } catch (filesystem_error const& err) {
+            return err.path1() == f
+                && err.path2() == ""
+                && err.code() == ec;
+        }
+#else
+        ((void)f); ((void)ec);
+        return true;
+#endif
+    };
+    scoped_test_env env;
+    const path bad_perms_dir = env.create_dir("bad_dir");
+    const path file_in_bad_dir = env.create_file(bad_perms_dir / "file", 42);
+    permissions(bad_perms_dir, perms::none);
+    const path dir_with_bad_dir = env.create_dir("dir");
+    make_tree(dir_with_bad_dir, 2, 3);
+    const path nested_bad_dir = env.create_dir("dir/dir1/bad_dir");
+    env.create_file(nested_bad_dir / "file", 42);
+    permissions(nested_bad_dir, perms::none);
+
+    const path testCases[] = {
+        env.make_env_path("dne"),
+        file_in_bad_dir,
+        dir_with_bad_dir
+    };
+    const auto BadRet = static_cast<std::uintmax_t>(-1);
+    for (auto& p : testCases) {
+        std::error_code ec;
+        TEST_CHECK(fs::parallel_remove_all(p, ec) == BadRet);
+        TEST_CHECK(ec);
+        TEST_CHECK(checkThrow(p, ec));
+    }
+    permissions(nested_bad_dir, perms::all);
+}
+
+TEST_CASE(basic_remove_all_test)
+{
+    scoped_test_env env;
+    const path dne = env.make_env_path("dne");
+    const path dir = env.create_dir("dir");
+    const path file = env.create_file("file", 42);
+    const path link = env.create_symlink(dir, "link");
+    const path bad_link = env.create_symlink(dne, "bad_link");
+    const path testCases[] = {file, env.create_dir("empty_dir"), link, bad_link};
+    for (auto& p : testCases) {
+        std::error_code ec = std::make_error_code(std::errc::address_in_use);
+        TEST_CHECK(fs::parallel_remove_all(p, ec) == 1);
+        TEST_CHECK(!ec);
+        TEST_CHECK(!exists(symlink_status(p)));
+    }
+    TEST_CHECK(exists(dir));
+}
+
+TEST_CASE(nested_dir)
+{
+    scoped_test_env env;
+    const path dir = env.create_dir("dir");
+    const path out_of_dir = env.create_dir("out_of_dir");
+    const path out_of_dir_file = env.create_file("out_of_dir/file", 42);
+    // Symlinks into the tree and out of it are removed, not followed.
+    const std::uintmax_t expected_count = 1 + make_tree(dir, 4, 4) + 2;
+    create_directory_symlink(out_of_dir, dir / "dir1/sym1");
+    create_directory_symlink(dir, dir / "dir2/dir3/sym2");
+
+    std::error_code ec = std::make_error_code(std::errc::address_in_use);
+    TEST_CHECK(fs::parallel_remove_all(dir, ec) == expected_count);
+    TEST_CHECK(!ec);
+    TEST_CHECK(!exists(symlink_status(dir)));
+    TEST_CHECK(exists(out_of_dir_file));
+}
+
+TEST_CASE(same_count_as_remove_all)
+{
+    scoped_test_env env;
+    const path dir1 = env.create_dir("dir1");
+    const path dir2 = env.create_dir("dir2");
+    make_tree(dir1, 3, 7);
+    make_tree(dir2, 3, 7);
+    TEST_CHECK(fs::parallel_remove_all(dir1) == fs::remove_all(dir2));
+    TEST_CHECK(!exists(dir1));
+    TEST_CHECK(!exists(dir2));
+}
+
+TEST_SUITE_END()
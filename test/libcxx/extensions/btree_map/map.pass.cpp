@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <ext/btree_map>
+
+// The std::map interface: construction, lookup, try_emplace, at, move-only
+// values, allocator propagation and comparisons.
+
+#include <ext/btree_map>
+#include <stdexcept>
+#include <cassert>
+
+#include "MoveOnly.h"
+#include "test_allocator.h"
+
+int main()
+{
+    {
+        typedef __gnu_cxx::btree_map<int, double> M;
+        M m = {{3, 3.5}, {1, 1.5}, {2, 2.5}, {1, 0.0}};
+        assert(m.size() == 3);
+        assert(m.begin()->first == 1);
+        assert(m.begin()->second == 1.5);
+        assert(m.rbegin()->first == 3);
+        assert(m.at(2) == 2.5);
+        try
+        {
+            m.at(4);
+            assert(false);
+        }
+        catch (std::out_of_range&)
+        {
+        }
+        m[4] = 4.5;
+        assert(m.size() == 4);
+        assert(m.count(4) == 1);
+        assert(m.count(5) == 0);
+
+        auto r = m.try_emplace(4, 0.0);
+        assert(!r.second);
+        assert(r.first->second == 4.5);
+        r = m.try_emplace(0, 0.5);
+        assert(r.second);
+        assert(m.begin() == r.first);
+
+        assert(m.lower_bound(2)->first == 2);
+        assert(m.upper_bound(2)->first == 3);
+        assert(m.lower_bound(5) == m.end());
+        auto e = m.equal_range(3);
+        assert(e.first->first == 3);
+        assert(e.second->first == 4);
+        e = m.equal_range(10);
+        assert(e.first == m.end() && e.second == m.end());
+
+        const M& c = m;
+        assert(c.find(1)->second == 1.5);
+        assert(c.find(7) == c.end());
+
+        M n(m);
+        assert(n == m);
+        n[5] = 5.5;
+        assert(n != m);
+        assert(m < n);
+        assert(n > m);
+        assert(m <= n && n >= m);
+        swap(m, n);
+        assert(m.size() == 6);
+        assert(n.size() == 5);
+    }
+    {
+        typedef __gnu_cxx::btree_map<int, MoveOnly> M;
+        M m;
+        for (int i = 0; i < 1000; ++i)
+            m.emplace(999 - i, MoveOnly(i));
+        for (int i = 0; i < 1000; ++i)
+            m.try_emplace(m.end(), i, MoveOnly(0));
+        assert(m.size() == 1000);
+        int i = 0;
+        for (M::iterator j = m.begin(); j != m.end(); ++j, ++i)
+        {
+            assert(j->first == i);
+            assert(j->second == MoveOnly(999 - i));
+        }
+        M n = std::move(m);
+        assert(n.size() == 1000);
+        assert(m.empty());
+        m = std::move(n);
+        assert(m.size() == 1000);
+        M::iterator j = m.erase(m.find(500));
+        assert(j->first == 501);
+        j = m.erase(m.begin(), m.find(100));
+        assert(j == m.begin());
+        assert(j->first == 100);
+        assert(m.size() == 899);
+    }
+    {
+        typedef std::pair<const int, int> V;
+        typedef __gnu_cxx::btree_map<int, int, std::less<int>, other_allocator<V> > M;
+        M m(other_allocator<V>(1));
+        for (int i = 0; i < 100; ++i)
+            m[i] = i;
+        M n(m);
+        assert(n.get_allocator() == other_allocator<V>(-2));
+        assert(n == m);
+        M o(other_allocator<V>(3));
+        o = m;
+        assert(o.get_allocator() == other_allocator<V>(1));
+        assert(o == m);
+        o.clear();
+        o = std::move(n);
+        assert(o.get_allocator() == other_allocator<V>(-2));
+        assert(o.size() == 100);
+    }
+    {
+        typedef std::pair<const int, int> V;
+        typedef __gnu_cxx::btree_map<int, int, std::less<int>, test_allocator<V> > M;
+        M m(test_allocator<V>(1));
+        for (int i = 0; i < 100; ++i)
+            m[i] = i;
+        M n(std::move(m), test_allocator<V>(2));
+        assert(n.size() == 100);
+        assert(n.get_allocator() == test_allocator<V>(2));
+        M o(n, test_allocator<V>(3));
+        assert(o == n);
+        o = n;
+        assert(o.get_allocator() == test_allocator<V>(3));
+        n.erase(n.begin(), n.find(50));
+        assert(o < n);
+    }
+}
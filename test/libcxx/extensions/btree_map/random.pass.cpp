@@ -0,0 +1,154 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <ext/btree_map>
+
+// A random mix of inserts, hinted inserts and erases keeps a btree_map in
+// step with a std::map, both for small values and for values so large that
+// a node only holds three of them.
+
+#include <ext/btree_map>
+#include <map>
+#include <random>
+#include <string>
+#include <cassert>
+
+struct Big
+{
+    int value;
+    char pad[200];
+
+    Big(int v = 0) : value(v) {}
+};
+
+bool operator==(const Big& x, const Big& y) {return x.value == y.value;}
+
+struct Str
+{
+    std::string value;
+
+    Str(int v = 0) : value(std::size_t(v & 63), char('a' + (v & 15))) {}
+};
+
+bool operator==(const Str& x, const Str& y) {return x.value == y.value;}
+
+template <class M, class R>
+void check(const M& m, const R& r)
+{
+    assert(m.size() == r.size());
+    typename M::const_iterator i = m.begin();
+    for (typename R::const_iterator j = r.begin(); j != r.end(); ++i, ++j)
+    {
+        assert(i != m.end());
+        assert(i->first == j->first);
+        assert(i->second == j->second);
+    }
+    assert(i == m.end());
+    typename M::const_reverse_iterator ri = m.rbegin();
+    for (typename R::const_reverse_iterator rj = r.rbegin(); rj != r.rend(); ++ri, ++rj)
+        assert(ri->first == rj->first);
+    assert(ri == m.rend());
+}
+
+template <class T>
+void test(int n, int range)
+{
+    typedef __gnu_cxx::btree_map<int, T> M;
+    typedef std::map<int, T> R;
+    std::mt19937 gen(n);
+    std::uniform_int_distribution<int> key(0, range);
+    std::uniform_int_distribution<int> op(0, 9);
+    M m;
+    R r;
+    for (int i = 0; i < n; ++i)
+    {
+        int k = key(gen);
+        switch (op(gen))
+        {
+        case 0: case 1: case 2:
+        {
+            auto x = m.insert(std::make_pair(k, T(i)));
+            auto y = r.insert(std::make_pair(k, T(i)));
+            assert(x.second == y.second);
+            assert(x.first->first == k);
+            assert(x.first->second == y.first->second);
+            break;
+        }
+        case 3: case 4:
+        {
+            auto h = m.lower_bound(k);
+            auto x = m.emplace_hint(h, k, T(i));
+            r.emplace_hint(r.lower_bound(k), k, T(i));
+            assert(x->first == k);
+            assert(x->second == r[k]);
+            break;
+        }
+        case 5:
+            m[k] = T(-i);
+            r[k] = T(-i);
+            break;
+        case 6: case 7:
+            assert(m.erase(k) == r.erase(k));
+            break;
+        case 8:
+        {
+            auto x = m.find(k);
+            auto y = r.find(k);
+            assert((x == m.end()) == (y == r.end()));
+            if (y != r.end())
+            {
+                auto nx = m.erase(x);
+                auto ny = r.erase(y);
+                assert((nx == m.end()) == (ny == r.end()));
+                if (ny != r.end())
+                    assert(nx->first == ny->first);
+            }
+            break;
+        }
+        case 9:
+        {
+            int k2 = k + range / 50;
+            auto x = m.erase(m.lower_bound(k), m.lower_bound(k2));
+            auto y = r.erase(r.lower_bound(k), r.lower_bound(k2));
+            assert((x == m.end()) == (y == r.end()));
+            if (y != r.end())
+                assert(x->first == y->first);
+            break;
+        }
+        }
+        assert(m.size() == r.size());
+        if (i % 500 == 0)
+            check(m, r);
+    }
+    check(m, r);
+
+    M c(m);
+    check(c, r);
+    M d;
+    d = std::move(c);
+    check(d, r);
+    assert(c.empty());
+    while (!d.empty())
+    {
+        r.erase(d.begin()->first);
+        d.erase(d.begin());
+    }
+    assert(r.empty());
+    m.clear();
+    assert(m.begin() == m.end());
+}
+
+int main()
+{
+    test<int>(20000, 2000);
+    test<Str>(5000, 300);
+    test<Big>(5000, 500);
+}
@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <ext/btree_set>
+
+// btree_set keeps the same elements, in the same order, as std::set.
+
+#include <ext/btree_set>
+#include <set>
+#include <string>
+#include <random>
+#include <cassert>
+
+template <class S, class R>
+void check(const S& s, const R& r)
+{
+    assert(s.size() == r.size());
+    typename S::const_iterator i = s.begin();
+    for (typename R::const_iterator j = r.begin(); j != r.end(); ++i, ++j)
+        assert(*i == *j);
+    assert(i == s.end());
+}
+
+int main()
+{
+    {
+        typedef __gnu_cxx::btree_set<int> S;
+        S s = {5, 3, 1, 3, 4};
+        assert(s.size() == 4);
+        assert(*s.begin() == 1);
+        assert(*s.rbegin() == 5);
+        assert(!s.insert(4).second);
+        assert(*s.emplace_hint(s.end(), 6) == 6);
+        assert(s.count(6) == 1);
+        assert(*s.lower_bound(2) == 3);
+        assert(*s.upper_bound(3) == 4);
+        assert(s.erase(3) == 1);
+        assert(s.erase(3) == 0);
+        assert(s == S({1, 4, 5, 6}));
+        assert(s < S({2}));
+        S::iterator i = s.find(4);
+        assert(*s.erase(i) == 5);
+    }
+    {
+        typedef __gnu_cxx::btree_set<int, std::greater<int> > S;
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int> dist(0, 5000);
+        S s;
+        std::set<int, std::greater<int> > r;
+        for (int i = 0; i < 20000; ++i)
+        {
+            int k = dist(gen);
+            if (i % 3 == 2)
+                assert(s.erase(k) == r.erase(k));
+            else
+                assert(s.insert(k).second == r.insert(k).second);
+        }
+        check(s, r);
+        S t(s.begin(), s.end());
+        check(t, r);
+        t.erase(t.begin(), t.end());
+        assert(t.empty());
+    }
+    {
+        typedef __gnu_cxx::btree_set<std::string> S;
+        S s;
+        std::set<std::string> r;
+        for (int i = 0; i < 2000; ++i)
+        {
+            std::string v(std::size_t(i % 37), char('a' + i % 23));
+            s.emplace(v);
+            r.insert(v);
+        }
+        check(s, r);
+        while (!r.empty())
+        {
+            r.erase(r.begin());
+            s.erase(s.begin());
+            assert(s.size() == r.size());
+        }
+    }
+}
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <ext/slab_allocator>
+
+// Single objects come from the pool one after another and are reused once
+// freed.  Copies share the pool and compare equal.
+
+#include <ext/slab_allocator>
+#include <cassert>
+
+struct Node
+{
+    Node* next;
+    long value;
+};
+
+struct Big
+{
+    char data[4096];
+};
+
+int main()
+{
+    typedef __gnu_cxx::slab_allocator<Node> A;
+    A a;
+    Node* p = a.allocate(1);
+    Node* q = a.allocate(1);
+    Node* r = a.allocate(1);
+    assert(q == p + 1);
+    assert(r == q + 1);
+
+    a.deallocate(q, 1);
+    assert(a.allocate(1) == q);
+
+    Node* arr = a.allocate(10);
+    arr[9].value = 9;
+    a.deallocate(arr, 10);
+
+    A b(a);
+    assert(a == b);
+    assert(b.allocate(1) == r + 1);
+    A c;
+    assert(a != c);
+    c = a;
+    assert(a == c);
+
+    __gnu_cxx::slab_allocator<int> i(a);
+    assert(i == a);
+    int* ip = i.allocate(1);
+    *ip = 1;
+    i.deallocate(ip, 1);
+
+    __gnu_cxx::slab_allocator<Big> big(a);
+    Big* bp = big.allocate(1);
+    bp->data[4095] = 'x';
+    big.deallocate(bp, 1);
+
+    a.deallocate(p, 1);
+    a.deallocate(q, 1);
+    a.deallocate(r, 1);
+}
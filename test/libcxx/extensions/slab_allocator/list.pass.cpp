@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <ext/slab_allocator>
+
+// list and forward_list keep working on nodes from a shared pool, including
+// erase and splice between containers that share it.
+
+#include <ext/slab_allocator>
+#include <list>
+#include <forward_list>
+#include <cassert>
+
+int main()
+{
+    {
+        typedef __gnu_cxx::slab_allocator<int> A;
+        typedef std::list<int, A> L;
+        A a;
+        L l(100, 1, a);
+        assert(l.size() == 100);
+        int ints[] = {2, 3, 4, 5, 6};
+        l.insert(l.begin(), ints, ints + 5);
+        assert(l.size() == 105);
+        assert(l.front() == 2);
+
+        L::iterator i = l.begin();
+        ++i;
+        i = l.erase(i);
+        assert(*i == 4);
+        l.remove(1);
+        assert(l.size() == 4);
+
+        L m(a);
+        m.push_back(7);
+        m.push_back(8);
+        l.splice(l.end(), m);
+        assert(m.empty());
+        assert(l.size() == 6);
+        assert(l.back() == 8);
+        m.splice(m.begin(), l, l.begin());
+        assert(m.front() == 2);
+
+        l.sort();
+        int expected[] = {4, 5, 6, 7, 8};
+        i = l.begin();
+        for (int k = 0; k < 5; ++k, ++i)
+            assert(*i == expected[k]);
+
+        L n;
+        n = l;
+        assert(n == l);
+        assert(n.get_allocator() == l.get_allocator());
+    }
+    {
+        typedef __gnu_cxx::slab_allocator<long> A;
+        typedef std::forward_list<long, A> L;
+        long longs[] = {1, 2, 3, 4, 5, 6, 7, 8};
+        A a;
+        L l(longs, longs + 8, a);
+        L m(a);
+        m.splice_after(m.before_begin(), l, l.before_begin(), l.end());
+        assert(l.empty());
+        long sum = 0;
+        for (L::iterator i = m.begin(); i != m.end(); ++i)
+            sum += *i;
+        assert(sum == 36);
+        m.remove_if([](long x) {return x % 2 == 0;});
+        m.insert_after(m.before_begin(), 100, 0);
+        assert(m.front() == 0);
+    }
+}
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <locale>
+
+// template <> class ctype<char>
+
+// The range members take a block-at-a-time path for long inputs when the
+// facet uses the classic table.  Check that they agree with the single
+// character members for every char value and every block alignment.
+
+#include <locale>
+#include <cassert>
+#include <cstddef>
+
+typedef std::ctype<char> F;
+
+const F::mask masks[] = {
+    F::space, F::print, F::cntrl, F::upper, F::lower, F::alpha, F::digit,
+    F::punct, F::xdigit, F::blank, F::alnum, F::graph,
+    F::space | F::digit, F::upper | F::punct, F::lower | F::cntrl,
+    static_cast<F::mask>(~0)
+};
+
+int main()
+{
+    const F& f = std::use_facet<F>(std::locale::classic());
+    char all[256 * 2];
+    for (int i = 0; i < 256 * 2; ++i)
+        all[i] = static_cast<char>(i);
+
+    for (std::size_t m = 0; m < sizeof(masks) / sizeof(masks[0]); ++m)
+    {
+        const F::mask mask = masks[m];
+        for (int start = 0; start < 256; ++start)
+        {
+            const char* low = all + start;
+            const char* high = low + 100;
+            const char* is = low;
+            while (is != high && !f.is(mask, *is))
+                ++is;
+            const char* isnt = low;
+            while (isnt != high && f.is(mask, *isnt))
+                ++isnt;
+            assert(f.scan_is(mask, low, high) == is);
+            assert(f.scan_not(mask, low, high) == isnt);
+        }
+    }
+    {
+        const char digits[] = "0123456789012345678901234567890123456789x";
+        assert(f.scan_not(F::digit, digits, digits + 41) == digits + 40);
+        assert(f.scan_is(F::alpha, digits, digits + 40) == digits + 40);
+    }
+    {
+        char up[256 * 2];
+        char low[256 * 2];
+        for (int i = 0; i < 256 * 2; ++i)
+            up[i] = low[i] = all[i];
+        assert(f.toupper(up + 3, up + 256 * 2) == up + 256 * 2);
+        assert(f.tolower(low + 3, low + 256 * 2) == low + 256 * 2);
+        for (int i = 0; i < 256 * 2; ++i)
+        {
+            assert(up[i] == (i < 3 ? all[i] : f.toupper(all[i])));
+            assert(low[i] == (i < 3 ? all[i] : f.tolower(all[i])));
+        }
+    }
+}
@@ -0,0 +1,160 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <codecvt>
+
+// The UTF-8 transcoders move long runs of ASCII a block at a time.  Check
+// in, out and length against a reference encoding for text mixing ASCII
+// runs of every length with multibyte characters, with output buffers that
+// end at every position, and with errors inside and right after a run.
+
+#include <codecvt>
+#include <locale>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+
+template <class CharT>
+struct text
+{
+    std::string utf8;
+    std::basic_string<CharT> wide;
+    std::vector<std::size_t> utf8_offset;   // of each wide character
+};
+
+void append_utf8(std::string& s, unsigned long c)
+{
+    if (c < 0x80)
+        s += static_cast<char>(c);
+    else if (c < 0x800)
+    {
+        s += static_cast<char>(0xC0 | (c >> 6));
+        s += static_cast<char>(0x80 | (c & 0x3F));
+    }
+    else if (c < 0x10000)
+    {
+        s += static_cast<char>(0xE0 | (c >> 12));
+        s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        s += static_cast<char>(0x80 | (c & 0x3F));
+    }
+    else
+    {
+        s += static_cast<char>(0xF0 | (c >> 18));
+        s += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+        s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        s += static_cast<char>(0x80 | (c & 0x3F));
+    }
+}
+
+// Code points are ASCII runs of 0 to 40 characters separated by a single
+// two or three byte character.
+template <class CharT>
+text<CharT> make_text(unsigned seed)
+{
+    text<CharT> t;
+    for (int run = 0; run < 12; ++run)
+    {
+        unsigned len = (seed = seed * 1103515245 + 12345) % 41;
+        for (unsigned i = 0; i < len; ++i)
+        {
+            t.utf8_offset.push_back(t.utf8.size());
+            t.utf8 += static_cast<char>('a' + (i + run) % 26);
+            t.wide += static_cast<CharT>('a' + (i + run) % 26);
+        }
+        unsigned long c = run % 2 ? 0xE9 : 0x20AC;
+        t.utf8_offset.push_back(t.utf8.size());
+        append_utf8(t.utf8, c);
+        t.wide += static_cast<CharT>(c);
+    }
+    t.utf8_offset.push_back(t.utf8.size());
+    return t;
+}
+
+template <class Facet>
+void test(const Facet& f)
+{
+    typedef typename Facet::intern_type CharT;
+    for (unsigned seed = 0; seed < 20; ++seed)
+    {
+        text<CharT> t = make_text<CharT>(seed);
+        const char* utf8 = t.utf8.data();
+        const std::size_t nbytes = t.utf8.size();
+        const std::size_t nchars = t.wide.size();
+
+        for (std::size_t room = 0; room <= nchars; ++room)
+        {
+            std::mbstate_t st = std::mbstate_t();
+            std::vector<CharT> out(room + 1);
+            const char* frm_nxt;
+            CharT* to_nxt;
+            std::codecvt_base::result r = f.in(st, utf8, utf8 + nbytes, frm_nxt,
+                                               out.data(), out.data() + room, to_nxt);
+            assert(r == (room == nchars ? std::codecvt_base::ok
+                                        : std::codecvt_base::partial));
+            assert(static_cast<std::size_t>(to_nxt - out.data()) == room);
+            assert(static_cast<std::size_t>(frm_nxt - utf8) == t.utf8_offset[room]);
+            assert(std::char_traits<CharT>::compare(out.data(), t.wide.data(), room) == 0);
+
+            st = std::mbstate_t();
+            assert(static_cast<std::size_t>(f.length(st, utf8, utf8 + nbytes, room)) ==
+                   t.utf8_offset[room]);
+        }
+
+        for (std::size_t room = 0; room <= nbytes; ++room)
+        {
+            std::mbstate_t st = std::mbstate_t();
+            std::vector<char> out(room + 1);
+            const CharT* frm_nxt;
+            char* to_nxt;
+            std::codecvt_base::result r = f.out(st, t.wide.data(), t.wide.data() + nchars,
+                                                frm_nxt, out.data(), out.data() + room,
+                                                to_nxt);
+            std::size_t done = static_cast<std::size_t>(frm_nxt - t.wide.data());
+            assert(r == (done == nchars ? std::codecvt_base::ok
+                                        : std::codecvt_base::partial));
+            assert(static_cast<std::size_t>(to_nxt - out.data()) == t.utf8_offset[done]);
+            assert(t.utf8_offset[done] <= room);
+            assert(done == nchars || t.utf8_offset[done + 1] > room);
+            assert(t.utf8.compare(0, t.utf8_offset[done], out.data(),
+                                  t.utf8_offset[done]) == 0);
+        }
+
+        // An invalid byte anywhere stops conversion right in front of it.
+        for (std::size_t i = 0; i < nchars; i += 7)
+        {
+            std::string bad = t.utf8;
+            bad[t.utf8_offset[i]] = static_cast<char>(0xFF);
+            std::mbstate_t st = std::mbstate_t();
+            std::vector<CharT> out(nchars);
+            const char* frm_nxt;
+            CharT* to_nxt;
+            std::codecvt_base::result r = f.in(st, bad.data(), bad.data() + bad.size(),
+                                               frm_nxt, out.data(), out.data() + nchars,
+                                               to_nxt);
+            assert(r == std::codecvt_base::error);
+            assert(static_cast<std::size_t>(frm_nxt - bad.data()) == t.utf8_offset[i]);
+            assert(static_cast<std::size_t>(to_nxt - out.data()) == i);
+            st = std::mbstate_t();
+            assert(static_cast<std::size_t>(f.length(st, bad.data(), bad.data() + bad.size(),
+                                                     nchars)) == t.utf8_offset[i]);
+        }
+    }
+}
+
+int main()
+{
+    test(std::codecvt_utf8<char32_t>());
+    test(std::codecvt_utf8<char16_t>());
+    test(std::codecvt_utf8<wchar_t>());
+    test(std::codecvt_utf8_utf16<char16_t>());
+    test(std::codecvt_utf8_utf16<char32_t>());
+    test(std::use_facet<std::codecvt<char16_t, char, std::mbstate_t> >(std::locale::classic()));
+    test(std::use_facet<std::codecvt<char32_t, char, std::mbstate_t> >(std::locale::classic()));
+}
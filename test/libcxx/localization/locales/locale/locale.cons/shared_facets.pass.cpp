@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <locale>
+
+// Locales built from the classic locale share its facets without counting
+// references to them.  Check that facets installed by the user are still
+// owned correctly when they sit next to, replace, or are replaced by classic
+// facets.
+
+#include <locale>
+#include <cassert>
+
+int destroyed = 0;
+
+struct my_facet
+    : public std::locale::facet
+{
+    static std::locale::id id;
+    ~my_facet() {++destroyed;}
+};
+
+std::locale::id my_facet::id;
+
+struct my_ctype
+    : public std::ctype<char>
+{
+    ~my_ctype() {++destroyed;}
+};
+
+int main()
+{
+    typedef std::ctype<char> C;
+    const C* classic_ctype = &std::use_facet<C>(std::locale::classic());
+    {
+        std::locale a(std::locale::classic(), new my_facet);
+        std::locale b(std::locale("C"), a, std::locale::numeric);
+        std::locale c(a, const_cast<C*>(classic_ctype));
+        std::locale d(c, "C", std::locale::ctype);
+        assert(std::has_facet<my_facet>(c));
+        assert(!std::has_facet<my_facet>(b));
+        assert(&std::use_facet<C>(c) == classic_ctype);
+        assert(&std::use_facet<C>(d) != classic_ctype);
+        assert(destroyed == 0);
+    }
+    assert(destroyed == 1);
+    for (int i = 0; i < 100; ++i)
+    {
+        std::locale e(std::locale::classic(), new my_ctype);
+        std::locale f(e, std::locale::classic(), std::locale::ctype);
+        assert(&std::use_facet<C>(f) == classic_ctype);
+    }
+    assert(destroyed == 101);
+    assert(std::use_facet<C>(std::locale()).toupper('a') == 'A');
+}
@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <valarray>
+
+// template<class T> class valarray;
+
+// value_type sum() const;
+// value_type min() const;
+// value_type max() const;
+
+// Large arrays are reduced in several parts.  Check that min() and max()
+// still return what comparing the elements in order gives, NaNs and signed
+// zeros included, and that the results of valarrays and of expressions
+// agree at every length around the unrolled loop.
+
+#include <valarray>
+#include <cmath>
+#include <limits>
+#include <cassert>
+
+template <class T>
+T seq_min(const std::valarray<T>& v)
+{
+    T r = v[0];
+    for (std::size_t i = 1; i < v.size(); ++i)
+        if (v[i] < r)
+            r = v[i];
+    return r;
+}
+
+template <class T>
+T seq_max(const std::valarray<T>& v)
+{
+    T r = v[0];
+    for (std::size_t i = 1; i < v.size(); ++i)
+        if (r < v[i])
+            r = v[i];
+    return r;
+}
+
+template <class T>
+bool same(T x, T y)
+{
+    if (x != x)
+        return y != y;
+    return x == y && std::signbit(x) == std::signbit(y);
+}
+
+template <class T>
+void test_lengths()
+{
+    for (std::size_t n = 1; n < 40; ++n)
+    {
+        std::valarray<T> v(n);
+        for (std::size_t i = 0; i < n; ++i)
+            v[i] = static_cast<T>((i * 7 + 3) % 11) - 5;
+        T s = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            s += v[i];
+        assert(v.sum() == s);
+        assert(v.min() == seq_min(v));
+        assert(v.max() == seq_max(v));
+        std::valarray<T> w = v + T(1);
+        assert((v + T(1)).sum() == T(s + T(n)));
+        assert((v + T(1)).min() == seq_min(w));
+        assert((v + T(1)).max() == seq_max(w));
+    }
+}
+
+template <class T>
+void test_special()
+{
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    for (std::size_t n = 1; n < 24; ++n)
+    {
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::valarray<T> v(T(1), n);
+            v[k] = nan;
+            v[n - 1 - k] = T(-2);
+            assert(same(v.min(), seq_min(v)));
+            assert(same(v.max(), seq_max(v)));
+            assert(same((+v).min(), seq_min(v)));
+            assert(same((+v).max(), seq_max(v)));
+        }
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::valarray<T> v(T(0), n);
+            v[k] = T(-0.);
+            assert(same(v.min(), seq_min(v)));
+            assert(same(v.max(), seq_max(v)));
+            v = T(-0.);
+            v[k] = T(0);
+            assert(same(v.min(), seq_min(v)));
+            assert(same(v.max(), seq_max(v)));
+        }
+    }
+}
+
+int main()
+{
+    test_lengths<int>();
+    test_lengths<unsigned char>();
+    test_lengths<long long>();
+    test_lengths<float>();
+    test_lengths<double>();
+    test_special<float>();
+    test_special<double>();
+    test_special<long double>();
+
+    // An element may depend on the same element of the left-hand side.
+    {
+        std::valarray<double> x(2., 37);
+        std::valarray<double> y(3., 37);
+        y = 2. * x + y;
+        y += y * x;
+        y -= y;
+        for (std::size_t i = 0; i < y.size(); ++i)
+            assert(y[i] == 0);
+    }
+}
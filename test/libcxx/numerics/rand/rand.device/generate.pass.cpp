@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// class random_device;
+
+// template <class RandomAccessIterator>
+//     void generate(RandomAccessIterator first, RandomAccessIterator last);
+
+#include <random>
+#include <vector>
+#include <cassert>
+
+#include "test_macros.h"
+
+template <class T>
+bool distinct(const std::vector<T>& v)
+{
+    for (std::size_t i = 0; i < v.size(); ++i)
+        for (std::size_t j = 0; j < i; ++j)
+            if (v[i] == v[j])
+                return false;
+    return true;
+}
+
+int main()
+{
+    {
+        std::random_device r;
+        std::vector<unsigned> v(1000);
+        r.generate(v.begin(), v.end());
+        assert(distinct(v));
+        std::vector<unsigned long long> w(300);
+        r.generate(w.begin(), w.end());
+        assert(distinct(w));
+        r.generate(v.begin(), v.begin());
+    }
+    {
+        // A random_device can seed the whole state of an engine.
+        std::random_device r;
+        std::mt19937 a(r);
+        std::mt19937 b(r);
+        assert(a != b);
+    }
+    {
+        // Interleaved single values and bulk requests.
+        std::random_device r;
+        std::vector<unsigned> v;
+        for (int i = 0; i < 5000; ++i)
+            v.push_back(r());
+        std::vector<unsigned> w(3);
+        r.generate(w.begin(), w.end());
+        v.insert(v.end(), w.begin(), w.end());
+        v.push_back(r());
+        unsigned ones = 0;
+        for (std::size_t i = 0; i < v.size(); ++i)
+            for (unsigned x = v[i]; x != 0; x &= x - 1)
+                ++ones;
+        // 5004 * 32 bits, about half of them set.
+        assert(ones > 78000 && ones < 82000);
+    }
+#ifndef TEST_HAS_NO_EXCEPTIONS
+    try
+    {
+        std::random_device r("/dev/null");
+        unsigned v[4];
+        r.generate(v, v + 4);
+        assert(false);
+    }
+    catch (const std::system_error&)
+    {
+    }
+#endif
+}
@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// template <class RealType> class uniform_real_distribution;
+// template <class RealType> class normal_distribution;
+
+// template <class ForwardIterator, class URNG>
+//     void generate(ForwardIterator first, ForwardIterator last, URNG& g);
+// template <class ForwardIterator, class URNG>
+//     void generate(ForwardIterator first, ForwardIterator last, URNG& g,
+//                   const param_type& parm);
+
+#include <random>
+#include <vector>
+#include <cassert>
+
+#include "test_macros.h"
+
+// Results of bulk generation must be those of the same number of calls,
+// and leave the engine and the distribution in the same state.
+template <class D, class G>
+void test(const typename D::param_type& p, std::size_t count)
+{
+    G g1;
+    G g2;
+    D d1(p);
+    D d2(p);
+    std::vector<typename D::result_type> v(count);
+    d1.generate(v.begin(), v.end(), g1);
+    for (std::size_t i = 0; i < count; ++i)
+        assert(v[i] == d2(g2));
+    assert(g1 == g2);
+    assert(d1 == d2);
+    assert(d1(g1) == d2(g2));
+
+    D d3;
+    d2.reset();
+    d3.generate(v.begin(), v.end(), g1, p);
+    for (std::size_t i = 0; i < count; ++i)
+        assert(v[i] == d2(g2, p));
+    assert(g1 == g2);
+}
+
+template <class D, class G>
+void test(const typename D::param_type& p)
+{
+    const std::size_t counts[] = {0, 1, 2, 3, 127, 128, 129, 1000, 3001};
+    for (std::size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+        test<D, G>(p, counts[i]);
+}
+
+template <class T>
+void test()
+{
+    typedef std::uniform_real_distribution<T> U;
+    typedef std::normal_distribution<T> N;
+    test<U, std::mt19937>(typename U::param_type(-3, 5));
+    test<U, std::mt19937_64>(typename U::param_type(0, 1));
+    test<U, std::minstd_rand>(typename U::param_type(2, 3));
+    test<U, std::ranlux24>(typename U::param_type(-1, 1));
+    test<N, std::mt19937>(typename N::param_type(5, 4));
+    test<N, std::mt19937_64>(typename N::param_type(0, 1));
+    test<N, std::minstd_rand>(typename N::param_type(-1, 2));
+}
+
+int main()
+{
+    test<float>();
+    test<double>();
+    test<long double>();
+}
@@ -0,0 +1,134 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// <random>
+
+// template<class IntType = int> class uniform_int_distribution;
+
+// Engines that return whole 32 or 64 bit words take the multiply and shift
+// path.  Check which engine values it rejects, and that results are in
+// range and unbiased for ranges where a plain modulo would be biased.
+
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cassert>
+
+#include "test_macros.h"
+
+// Returns the values it was given, in order.
+template <class UInt>
+struct replay
+{
+    typedef UInt result_type;
+    static TEST_CONSTEXPR result_type min() {return 0;}
+    static TEST_CONSTEXPR result_type max() {return ~result_type(0);}
+
+    const UInt* p_;
+    int calls_;
+
+    explicit replay(const UInt* p) : p_(p), calls_(0) {}
+    result_type operator()() {++calls_; return *p_++;}
+};
+
+void test_rejection()
+{
+    // 2^32 % 3 == 1, so only x == 0 is rejected.
+    {
+        const std::uint32_t x[] = {0, 0x80000000u};
+        replay<std::uint32_t> g(x);
+        std::uniform_int_distribution<unsigned> d(0, 2);
+        assert(d(g) == 1);
+        assert(g.calls_ == 2);
+    }
+    {
+        const std::uint32_t x[] = {1, 0xFFFFFFFFu};
+        replay<std::uint32_t> g(x);
+        std::uniform_int_distribution<int> d(10, 12);
+        assert(d(g) == 10);
+        assert(d(g) == 12);
+        assert(g.calls_ == 2);
+    }
+    // A 64 bit result type with a 32 bit range uses one word.
+    {
+        const std::uint32_t x[] = {0xC0000000u};
+        replay<std::uint32_t> g(x);
+        std::uniform_int_distribution<long long> d(-2, 1);
+        assert(d(g) == 1);
+        assert(g.calls_ == 1);
+    }
+#ifndef _LIBCPP_HAS_NO_INT128
+    // 2^64 % 3 == 1 as well.
+    {
+        const std::uint64_t x[] = {0, 0x8000000000000000ull};
+        replay<std::uint64_t> g(x);
+        std::uniform_int_distribution<unsigned long long> d(0, 2);
+        assert(d(g) == 1);
+        assert(g.calls_ == 2);
+    }
+    {
+        const std::uint64_t x[] = {0xFFFFFFFFFFFFFFFFull};
+        replay<std::uint64_t> g(x);
+        std::uniform_int_distribution<unsigned char> d(0, 99);
+        assert(d(g) == 99);
+        assert(g.calls_ == 1);
+    }
+#endif
+}
+
+// Splits [0, r) into k equal parts and checks the counts with a chi-square
+// test.  For r = 3 * 2^30, taking x % r would make the first third twice as
+// likely as the others.
+template <class G, class UInt>
+void test_fit(UInt r)
+{
+    const int N = 300000;
+    const int k = 30;
+    G g;
+    std::uniform_int_distribution<UInt> d(0, r - 1);
+    std::vector<long> count(k);
+    for (int i = 0; i < N; ++i)
+    {
+        const UInt x = d(g);
+        assert(x < r);
+        ++count[static_cast<std::size_t>(x / (r / k + (r % k != 0)))];
+    }
+    double chi2 = 0;
+    for (int b = 0; b < k; ++b)
+    {
+        const double lo = double(r / k + (r % k != 0)) * b;
+        const double hi = std::min(double(r), lo + double(r / k + (r % k != 0)));
+        const double e = N * (hi - lo) / double(r);
+        chi2 += (count[b] - e) * (count[b] - e) / e;
+    }
+    assert(chi2 < 80);
+}
+
+template <class G>
+void test_engine()
+{
+    test_fit<G, unsigned>(30);
+    test_fit<G, unsigned>(1000);
+    test_fit<G, unsigned>(3u << 30);
+    test_fit<G, unsigned long long>(3u << 30);
+    test_fit<G, unsigned long long>(3ull << 62);
+}
+
+int main()
+{
+    test_rejection();
+    test_engine<std::mt19937>();
+    test_engine<std::mt19937_64>();
+    test_engine<std::minstd_rand>();
+    test_engine<std::ranlux24>();
+}
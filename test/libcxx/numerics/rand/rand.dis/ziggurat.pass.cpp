@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// REQUIRES: long_tests
+
+// <random>
+
+// template<class RealType = double> class normal_distribution;
+// template<class RealType = double> class exponential_distribution;
+
+// Check the ziggurat implementations selected by
+// _LIBCPP_ENABLE_ZIGGURAT_DISTRIBUTIONS against the distributions they
+// sample: the layer tables, and a chi-square test over bins that reach
+// into the tails.
+
+#define _LIBCPP_ENABLE_ZIGGURAT_DISTRIBUTIONS
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cassert>
+
+#include "test_macros.h"
+
+double normal_f(double x) {return std::exp(-x * x / 2);}
+double normal_cdf(double x) {return std::erfc(-x / std::sqrt(2.)) / 2;}
+double exponential_f(double x) {return std::exp(-x);}
+double exponential_cdf(double x) {return x <= 0 ? 0 : -std::expm1(-x);}
+
+// All layers have the area of the base layer, which includes the tail.
+void test_table(const double* x, std::size_t n, double (*f)(double), double tail)
+{
+    const double v = x[1] * f(x[1]) + tail;
+    assert(std::abs(x[0] * f(x[1]) - v) < 1e-14);
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        assert(x[i + 1] < x[i]);
+        assert(std::abs(x[i] * (f(x[i + 1]) - f(x[i])) - v) < 1e-12);
+    }
+    assert(x[n] == 0);
+}
+
+// Sorts N samples into bins [edges[i], edges[i+1]) plus one bin below the
+// first edge and one above the last, and checks the counts against cdf.
+// The critical value is about the 1e-6 quantile of the chi-square
+// distribution with 60 to 100 degrees of freedom.
+template <class D, class G>
+void test_fit(D d, const std::vector<double>& edges, double (*cdf)(double),
+              double mean, double scale)
+{
+    const int N = 2000000;
+    G g;
+    std::vector<long> count(edges.size() + 1);
+    for (int i = 0; i < N; ++i)
+    {
+        const double x = (static_cast<double>(d(g)) - mean) / scale;
+        std::size_t b = std::upper_bound(edges.begin(), edges.end(), x) - edges.begin();
+        ++count[b];
+    }
+    double chi2 = 0;
+    for (std::size_t b = 0; b < count.size(); ++b)
+    {
+        const double lo = b == 0 ? 0 : cdf(edges[b - 1]);
+        const double hi = b == edges.size() ? 1 : cdf(edges[b]);
+        const double e = N * (hi - lo);
+        chi2 += (count[b] - e) * (count[b] - e) / e;
+    }
+    const double df = count.size() - 1;
+    assert(chi2 < df + 5 * std::sqrt(2 * df));
+}
+
+template <class T, class G>
+void test_normal()
+{
+    std::vector<double> edges;
+    for (double x = -4.5; x < 4.55; x += 0.15)
+        edges.push_back(x);
+    test_fit<std::normal_distribution<T>, G>(std::normal_distribution<T>(),
+                                             edges, normal_cdf, 0, 1);
+    test_fit<std::normal_distribution<T>, G>(std::normal_distribution<T>(3, 0.5),
+                                             edges, normal_cdf, 3, 0.5);
+}
+
+template <class T, class G>
+void test_exponential()
+{
+    std::vector<double> edges;
+    for (double x = 0.125; x < 10.05; x += 0.125)
+        edges.push_back(x);
+    test_fit<std::exponential_distribution<T>, G>(std::exponential_distribution<T>(),
+                                                  edges, exponential_cdf, 0, 1);
+    test_fit<std::exponential_distribution<T>, G>(std::exponential_distribution<T>(4),
+                                                  edges, exponential_cdf, 0, .25);
+}
+
+template <class T>
+void test()
+{
+    test_normal<T, std::mt19937>();
+    test_normal<T, std::mt19937_64>();
+    test_normal<T, std::minstd_rand>();
+    test_exponential<T, std::mt19937>();
+    test_exponential<T, std::mt19937_64>();
+    test_exponential<T, std::minstd_rand>();
+}
+
+int main()
+{
+    test_table(std::__ziggurat_tables<>::__normal_x, 128, normal_f,
+               std::sqrt(std::atan(1.) * 2) * std::erfc(3.4426198558966523 / std::sqrt(2.)));
+    test_table(std::__ziggurat_tables<>::__exponential_x, 256, exponential_f,
+               std::exp(-7.6971174701310501));
+    test<float>();
+    test<double>();
+    test<long double>();
+
+    // generate() gives the values of as many calls to operator().
+    std::normal_distribution<> d;
+    std::mt19937 g;
+    std::vector<double> v(1001);
+    d.generate(v.begin(), v.end(), g);
+    std::mt19937 g2;
+    std::normal_distribution<> d2;
+    for (std::size_t i = 0; i < v.size(); ++i)
+        assert(v[i] == d2(g2));
+}
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// template <class UIntType, size_t w, size_t n, size_t m, size_t r,
+//           UIntType a, size_t u, UIntType d, size_t s,
+//           UIntType b, size_t t, UIntType c, size_t l, UIntType f>
+// class mersenne_twister_engine;
+
+// template <class ForwardIterator>
+//     void generate(ForwardIterator first, ForwardIterator last);
+
+#include <random>
+#include <list>
+#include <vector>
+#include <cassert>
+
+#include "test_macros.h"
+
+template <class E>
+void test_matches_call(std::size_t skip, std::size_t count)
+{
+    E e1;
+    e1.discard(skip);
+    E e2 = e1;
+    std::vector<typename E::result_type> v(count);
+    e1.generate(v.begin(), v.end());
+    for (std::size_t i = 0; i < count; ++i)
+        assert(v[i] == e2());
+    assert(e1 == e2);
+    assert(e1() == e2());
+}
+
+template <class E>
+void test(typename E::result_type x10000)
+{
+    E e;
+    std::vector<typename E::result_type> v(10000);
+    e.generate(v.begin(), v.end());
+    assert(v.back() == x10000);
+
+    E e2;
+    e2.generate(v.begin(), v.begin() + 1);
+    e2.generate(v.begin() + 1, v.begin() + 700);
+    e2.generate(v.begin() + 700, v.begin() + 1900);
+    e2.generate(v.begin() + 1900, v.begin() + 1900);
+    e2.generate(v.begin() + 1900, v.end());
+    assert(v.back() == x10000);
+    assert(e == e2);
+
+    const std::size_t n = E::state_size;
+    const std::size_t m = E::shift_size;
+    const std::size_t counts[] = {0, 1, 2, n - m - 1, n - m, n - m + 1,
+                                  n - 1, n, n + 1, 2 * n + 7};
+    for (std::size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+        for (std::size_t j = 0; j < sizeof(counts) / sizeof(counts[0]); ++j)
+            test_matches_call<E>(counts[i], counts[j]);
+}
+
+void test_discard()
+{
+    std::mt19937 e1;
+    std::mt19937 e2;
+    e1.discard(9999);
+    for (int i = 0; i < 9999; ++i)
+        e2();
+    assert(e1 == e2);
+    assert(e1() == 4123659995u);
+}
+
+void test_iterators()
+{
+    std::mt19937 e1;
+    std::mt19937 e2;
+    std::list<unsigned long long> l(1000);
+    e1.generate(l.begin(), l.end());
+    for (std::list<unsigned long long>::iterator i = l.begin(); i != l.end(); ++i)
+        assert(*i == e2());
+}
+
+// A small engine, so that the state wraps around many times.
+typedef std::mersenne_twister_engine<unsigned, 16, 5, 2, 7,
+                                     0xB1F3u, 3, 0xFFFFu, 5, 0x2D40u,
+                                     9, 0x6400u, 11, 0x6C07u> small_mt;
+typedef std::mersenne_twister_engine<unsigned, 32, 3, 3, 31,
+                                     0x9908b0dfu, 11, 0xffffffffu, 7,
+                                     0x9d2c5680u, 15, 0xefc60000u, 18,
+                                     1812433253u> full_shift_mt;
+
+int main()
+{
+    test<std::mt19937>(4123659995u);
+    test<std::mt19937_64>(9981545732273789042ull);
+    test_discard();
+    test_iterators();
+    for (std::size_t i = 0; i < 12; ++i)
+        for (std::size_t j = 0; j < 12; ++j)
+        {
+            test_matches_call<small_mt>(i, j);
+            test_matches_call<full_shift_mt>(i, j);
+        }
+}
@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <string>
+
+// _LIBCPP_STRING_GROWTH_PERCENT sets how fast appending grows the capacity.
+// Use an allocator that the dylib has no instantiations for, since it was
+// built with the default.
+
+// MODULES_DEFINES: _LIBCPP_STRING_GROWTH_PERCENT=150
+#define _LIBCPP_STRING_GROWTH_PERCENT 150
+#include <string>
+#include <cassert>
+#include <cstddef>
+
+#include "test_allocator.h"
+
+int main()
+{
+    typedef std::basic_string<char, std::char_traits<char>, test_allocator<char> > S;
+    S s;
+    std::size_t cap = s.capacity();
+    int grows = 0;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        s.push_back(char('a' + i % 26));
+        if (s.capacity() != cap)
+        {
+            if (cap >= 100)
+            {
+                assert(s.capacity() >= cap / 2 * 3);
+                assert(s.capacity() < cap / 2 * 3 + 32);
+            }
+            cap = s.capacity();
+            ++grows;
+        }
+    }
+    assert(grows > 20);
+    for (std::size_t i = 0; i < s.size(); ++i)
+        assert(s[i] == char('a' + i % 26));
+}
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <string>
+
+// _LIBCPP_ABI_LARGE_STRING_SSO doubles the short string buffer.  Use an
+// allocator that the dylib has no instantiations for, since it was built
+// without the macro.
+
+// MODULES_DEFINES: _LIBCPP_ABI_LARGE_STRING_SSO
+#define _LIBCPP_ABI_LARGE_STRING_SSO
+#include <string>
+#include <cassert>
+#include <cstddef>
+
+#include "test_allocator.h"
+
+template <class CharT>
+void test()
+{
+    typedef std::basic_string<CharT, std::char_traits<CharT>, test_allocator<CharT> > S;
+    const std::size_t rep_size = 2 * (2 * sizeof(typename S::size_type) +
+                                      sizeof(typename S::pointer));
+    const std::size_t inline_cap = (rep_size - 1) / sizeof(CharT) - 1;
+
+    S s;
+    assert(s.capacity() == inline_cap);
+    int allocs = test_alloc_base::alloc_count;
+    for (std::size_t i = 0; i < inline_cap; ++i)
+        s.push_back(CharT('a' + i % 26));
+    assert(test_alloc_base::alloc_count == allocs);
+    {
+        S t(s);
+        assert(t == s);
+        assert(test_alloc_base::alloc_count == allocs);
+    }
+
+    s.push_back(CharT('z'));
+    assert(s.capacity() > inline_cap);
+    assert(s.size() == inline_cap + 1);
+    for (std::size_t i = 0; i < inline_cap; ++i)
+        assert(s[i] == CharT('a' + i % 26));
+    assert(s[inline_cap] == CharT('z'));
+
+    s.pop_back();
+    s.shrink_to_fit();
+    assert(s.capacity() == inline_cap);
+    for (std::size_t i = 0; i < inline_cap; ++i)
+        assert(s[i] == CharT('a' + i % 26));
+    assert(s.c_str()[inline_cap] == CharT());
+
+    S l(200, CharT('x'));
+    S m(l.begin(), l.begin() + 10);
+    l.swap(m);
+    assert(l.size() == 10 && m.size() == 200);
+    assert(m == S(200, CharT('x')));
+}
+
+int main()
+{
+    test<char>();
+    test<wchar_t>();
+#ifndef _LIBCPP_HAS_NO_UNICODE_CHARS
+    test<char16_t>();
+    test<char32_t>();
+#endif
+}
@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <string>
+
+// void __resize_default_init(size_type n); // libc++ extension
+
+// Like resize(n), but the added characters are left as they were in the
+// buffer.
+
+#include <string>
+#include <cassert>
+
+template <class S>
+void test()
+{
+    typedef typename S::value_type C;
+    S s;
+    s.reserve(100);
+    s.assign(100, C('x'));
+    s.__resize_default_init(10);
+    assert(s.size() == 10);
+    assert(s.c_str()[10] == C());
+    s.__resize_default_init(100);
+    assert(s.size() == 100);
+    for (int i = 11; i < 100; ++i)
+        assert(s[i] == C('x'));
+    assert(s.c_str()[100] == C());
+
+    S t(5, C('a'));
+    t.__resize_default_init(1000);
+    assert(t.size() == 1000);
+    assert(t.capacity() >= 1000);
+    assert(t.compare(0, 5, S(5, C('a'))) == 0);
+    assert(t.c_str()[1000] == C());
+    t.__resize_default_init(3);
+    assert(t == S(3, C('a')));
+}
+
+int main()
+{
+    test<std::string>();
+    test<std::wstring>();
+}
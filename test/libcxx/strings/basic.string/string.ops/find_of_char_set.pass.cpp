@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <string>
+
+// find_first_of, find_last_of, find_first_not_of, find_last_not_of
+
+// With char_traits<char> the set of characters is looked up in a table
+// indexed by the value of each char.  Check all 256 values, including the
+// negative ones, against a plain search of the set, and check that other
+// traits still go through their own eq.
+
+#include <string>
+#include <cassert>
+#include <cstddef>
+
+std::size_t ref_first(const std::string& h, const std::string& set, bool in)
+{
+    for (std::size_t i = 0; i < h.size(); ++i)
+        if ((set.find(h[i]) != std::string::npos) == in)
+            return i;
+    return std::string::npos;
+}
+
+std::size_t ref_last(const std::string& h, const std::string& set, bool in)
+{
+    for (std::size_t i = h.size(); i != 0; --i)
+        if ((set.find(h[i - 1]) != std::string::npos) == in)
+            return i - 1;
+    return std::string::npos;
+}
+
+struct nocase_traits
+    : public std::char_traits<char>
+{
+    static bool eq(char a, char b) {return (a | 0x20) == (b | 0x20);}
+    static const char* find(const char* s, std::size_t n, char c)
+    {
+        for (; n; --n, ++s)
+            if (eq(*s, c))
+                return s;
+        return 0;
+    }
+};
+
+int main()
+{
+    std::string all;
+    for (int c = 0; c < 256; ++c)
+        all += static_cast<char>(c);
+
+    for (int step = 1; step < 100; step += 7)
+    {
+        std::string set;
+        for (int c = step % 256; c < 256; c += step)
+            set += static_cast<char>(c);
+        for (std::size_t len = 0; len <= all.size(); len += 37)
+        {
+            std::string h = all.substr(256 - len) + all.substr(0, 256 - len);
+            assert(h.find_first_of(set) == ref_first(h, set, true));
+            assert(h.find_last_of(set) == ref_last(h, set, true));
+            assert(h.find_first_not_of(set) == ref_first(h, set, false));
+            assert(h.find_last_not_of(set) == ref_last(h, set, false));
+        }
+    }
+
+    typedef std::basic_string<char, nocase_traits> S;
+    S h("Hello, World");
+    assert(h.find_first_of("WXYZ") == 7);
+    assert(h.find_first_of("wxyz") == 7);
+    assert(h.find_last_of("HL") == 10);
+    assert(h.find_first_not_of("hEl") == 4);
+    assert(h.find_last_not_of("DLR") == 8);
+}
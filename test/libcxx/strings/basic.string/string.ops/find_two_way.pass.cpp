@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <string>
+
+// size_type find(const basic_string& str, size_type pos = 0) const;
+
+// On repetitive text find switches from scanning for the first character of
+// the pattern to the two-way algorithm.  Check the two-way search itself
+// against std::search for every short pattern over a two letter alphabet,
+// and find on text that forces the switch.
+
+#include <string>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+typedef std::char_traits<char> T;
+
+void check(const std::string& text, const std::string& pat)
+{
+    const char* first = text.data();
+    const char* last = first + text.size();
+    const char* expected = std::search(first, last, pat.data(), pat.data() + pat.size());
+    const char* r = std::__two_way_search<char, T>(first, last, pat.data(),
+                                                   static_cast<std::ptrdiff_t>(pat.size()));
+    assert(r == expected);
+}
+
+int main()
+{
+    std::string text;
+    for (unsigned seed = 1; text.size() < 2000; seed = seed * 1103515245 + 12345)
+        text += (seed >> 16) % 3 ? 'a' : 'b';
+
+    for (std::size_t len = 1; len <= 10; ++len)
+        for (unsigned bits = 0; bits < (1u << len); ++bits)
+        {
+            std::string pat;
+            for (std::size_t i = 0; i < len; ++i)
+                pat += bits & (1u << i) ? 'b' : 'a';
+            check(text, pat);
+            check(text.substr(0, 40), pat);
+            check(pat, pat);
+        }
+
+    // "aaa...a" searched for "aa...ab" and similar patterns, long enough
+    // for find to give up on its first character scan.
+    std::string a(100000, 'a');
+    std::string needle = std::string(999, 'a') + "b";
+    assert(a.find(needle) == std::string::npos);
+    assert((a + needle).find(needle) == a.size());
+    needle = "b" + std::string(999, 'a');
+    assert(a.find(needle) == std::string::npos);
+    needle = std::string(500, 'a') + "b" + std::string(499, 'a');
+    std::string s = a + needle + a;
+    assert(s.find(needle) == a.size());
+    assert(s.find(needle, a.size() + 1) == std::string::npos);
+    for (std::size_t i = 0; i < 2000; i += 100)
+    {
+        std::string t = a.substr(0, 3000 + i) + needle;
+        assert(t.find(needle) == 3000 + i);
+    }
+}
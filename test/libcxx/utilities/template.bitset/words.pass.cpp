@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <bitset>
+
+// to_string() and the string constructors convert a word at a time.  Check
+// them against the bits for sizes on either side of a word boundary, and
+// check the _Find_first() and _Find_next() extensions.
+
+#include <bitset>
+#include <string>
+#include <cassert>
+
+#include "test_macros.h"
+
+template <std::size_t N>
+void test()
+{
+    std::bitset<N> b;
+    assert(b._Find_first() == N);
+    unsigned seed = 1;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        if ((seed >> 16) & 1)
+            b.set(i);
+    }
+    std::string s = b.to_string('.', 'X');
+    assert(s.size() == N);
+    for (std::size_t i = 0; i < N; ++i)
+        assert(s[N - 1 - i] == (b[i] ? 'X' : '.'));
+    assert(std::bitset<N>(s, 0, std::string::npos, '.', 'X') == b);
+    assert(std::bitset<N>(s.c_str(), std::string::npos, '.', 'X') == b);
+
+    // Strings shorter and longer than the bitset.
+    std::string t = "x" + s + "XX.X";
+    std::bitset<N> c(t, 1, 4 + N / 2, '.', 'X');
+    for (std::size_t i = 0; i < N; ++i)
+        assert(c[i] == (i < 4 + N / 2 && i < N && t[4 + N / 2 - i] == 'X'));
+
+    std::size_t prev = 0;
+    std::size_t i = b._Find_first();
+    for (; i < N; prev = i, i = b._Find_next(i))
+    {
+        assert(b[i]);
+        for (std::size_t j = (i == b._Find_first() ? 0 : prev + 1); j < i; ++j)
+            assert(!b[j]);
+    }
+    assert(i == N);
+    assert(b._Find_next(N) == N);
+    assert(b._Find_next(std::size_t(-1)) == N);
+}
+
+int main()
+{
+    test<0>();
+    test<1>();
+    test<31>();
+    test<32>();
+    test<33>();
+    test<63>();
+    test<64>();
+    test<65>();
+    test<127>();
+    test<128>();
+    test<1000>();
+}
@@ -0,0 +1,131 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <regex>
+
+// template <class BidirectionalIterator, class Allocator, class charT, class traits>
+//     bool
+//     regex_search(BidirectionalIterator first, BidirectionalIterator last,
+//                  match_results<BidirectionalIterator, Allocator>& m,
+//                  const basic_regex<charT, traits>& e,
+//                  regex_constants::match_flag_type flags = regex_constants::match_default);
+
+// Patterns without a literal prefix, whose matches can only begin with some
+// characters.  Each search must find the same match as trying every position
+// in turn with match_continuous.  ^ only matches at the first position, so
+// the attempts at the others also pass match_not_bol.  The set of first
+// characters is only worked out by a search that has tried many positions,
+// so every text is also tried after a long run of filler, and each regex is
+// searched twice: once to work out the set and once to use it.
+
+#include <regex>
+#include <string>
+#include <cassert>
+#include "test_macros.h"
+
+template <class CharT>
+void test(const CharT* pattern, const std::basic_string<CharT>& text,
+          std::regex_constants::syntax_option_type f = std::regex_constants::ECMAScript)
+{
+    typedef std::regex_constants::match_flag_type flag_type;
+    std::basic_regex<CharT> re(pattern, f);
+    const CharT* first = text.data();
+    const CharT* last = first + text.size();
+    std::match_results<const CharT*> m;
+    bool found = std::regex_search(first, last, m, re);
+    std::match_results<const CharT*> again;
+    assert(std::regex_search(first, last, again, re) == found);
+    if (found)
+        assert(again[0] == m[0]);
+    std::match_results<const CharT*> expected;
+    bool expected_found = std::regex_search(first, last, expected, re,
+                                            std::regex_constants::match_continuous);
+    for (const CharT* p = first; p != last && !expected_found;)
+    {
+        const flag_type flags = std::regex_constants::match_continuous |
+                                std::regex_constants::match_prev_avail |
+                                std::regex_constants::match_not_bol;
+        if (++p != last)
+            expected_found = std::regex_search(p, last, expected, re, flags);
+    }
+    assert(found == expected_found);
+    if (found)
+    {
+        assert(m[0].first == expected[0].first);
+        assert(m[0].second == expected[0].second);
+        assert(m.size() == expected.size());
+        for (std::size_t i = 1; i < m.size(); ++i)
+        {
+            assert(m[i].matched == expected[i].matched);
+            if (m[i].matched)
+                assert(m[i].str() == expected[i].str());
+        }
+    }
+}
+
+void test(const char* pattern, const char* text,
+          std::regex_constants::syntax_option_type f = std::regex_constants::ECMAScript)
+{
+    test(pattern, std::string(text), f);
+    test(pattern, std::string(1000, 'z') + text, f);
+}
+
+int main()
+{
+    const char* texts[] = {
+        "", "x", "ERROR: 42", "INFO: 1\nFATAL: 7\nERROR: 8",
+        "abc abd ABD", "key=val id=42", "\nline\nLine2", "a\xe9\xff" "b"
+    };
+    const char* patterns[] = {
+        "[E]RROR: ([0-9]+)", "(ERROR|FATAL): ([0-9]+)", "\\d+", "[a-z]+=([0-9]+)",
+        "(?:ab)+[cd]", "a*b", "(a|b)?c", "[^a-z]", ".", "(x|)", "^L", "$",
+        "\\bab", "(?=a)ab", "(a)\\1", "[\xe9-\xff]", "[[:upper:]]+", "x{2,}|e"
+    };
+    for (unsigned i = 0; i < sizeof(patterns) / sizeof(patterns[0]); ++i)
+    {
+        for (unsigned j = 0; j < sizeof(texts) / sizeof(texts[0]); ++j)
+        {
+            test(patterns[i], texts[j]);
+            test(patterns[i], texts[j], std::regex_constants::icase);
+            test(patterns[i], texts[j], std::regex_constants::ECMAScript |
+                                        std::regex_constants::collate);
+        }
+    }
+    test("\\([EF]\\)x*", "aFx", std::regex_constants::basic);
+    test("(E|F)x*", "aFx", std::regex_constants::extended);
+    test("[0-9]+", "ab12", std::regex_constants::awk);
+    test("Ex\nFx", "aFx", std::regex_constants::grep);
+    test("Ex|Fx", "aFx", std::regex_constants::egrep);
+    test("a.c", std::string("\0abc\0a\0c", 9));
+    test("a.c", std::string(1000, '\0') + std::string("\0abc\0a\0c", 9));
+    test(L"[\x3b1-\x3c9]+", std::wstring(L"abc\x3b2\x3b3"));
+    test(L"(x|\x3b2)", std::wstring(L"abc\x3b2\x3b3"));
+    test(L"[0-9]", std::wstring(L"\x3b2" L"9"));
+    test(L"[0-9]", std::wstring(1000, L'\x3b2') + L"9");
+    test(L"\x3b2[0-9]", std::wstring(1000, L'z') + L"\x3b2" L"9");
+    {
+        // Copies and swaps keep the first characters with the pattern.
+        std::regex r1("[0-9]");
+        std::regex r2("[a-z]");
+        r1.swap(r2);
+        assert(std::regex_search("12ab", r1));
+        assert(!std::regex_search("12", r1));
+        std::regex r3 = r2;
+        assert(std::regex_search("ab12", r3));
+        assert(!std::regex_search("ab", r3));
+        const std::string digits(1000, '1');
+        const std::string letters(1000, 'a');
+        assert(!std::regex_search(digits, r1));
+        assert(std::regex_search(digits + "a", r1));
+        assert(!std::regex_search(letters, r3));
+        assert(std::regex_search(letters + "1", r3));
+        assert(std::regex_search(letters + "1", r2));
+        assert(!std::regex_search(letters, r2));
+    }
+}
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <regex>
+
+// template <class BidirectionalIterator, class Allocator, class charT, class traits>
+//     bool
+//     regex_search(BidirectionalIterator first, BidirectionalIterator last,
+//                  match_results<BidirectionalIterator, Allocator>& m,
+//                  const basic_regex<charT, traits>& e,
+//                  regex_constants::match_flag_type flags = regex_constants::match_default);
+
+// Patterns that begin with literal characters, including ones where a later
+// quantifier or alternation makes part of that literal run optional.
+
+#include <regex>
+#include <string>
+#include <cassert>
+#include "test_macros.h"
+
+template <class CharT>
+void test(const CharT* pattern, const CharT* text, int pos, int len,
+          std::regex_constants::syntax_option_type f = std::regex_constants::ECMAScript)
+{
+    std::match_results<const CharT*> m;
+    std::basic_regex<CharT> re(pattern, f);
+    bool found = std::regex_search(text, m, re);
+    if (pos < 0)
+    {
+        assert(!found);
+        assert(m.size() == 0);
+        return;
+    }
+    assert(found);
+    assert(m.position(0) == pos);
+    assert(m.length(0) == len);
+    assert(m.prefix().first == text);
+    assert(m.prefix().second == text + pos);
+    assert(m.suffix().first == text + pos + len);
+}
+
+int main()
+{
+    test("ERROR: ([0-9]+)", "INFO: 1\nWARN: 2\nERROR: 42\n", 16, 9);
+    test("ERROR: ([0-9]+)", "INFO: 1\nERROR: x\nERROR: 7", 17, 8);
+    test("ERROR: ([0-9]+)", "INFO: 1\nWARN: 2\n", -1, 0);
+    test("abc", "xxabxxabc", 6, 3);
+    test("abc", "ab", -1, 0);
+    test("ab*c", "xxac", 2, 2);
+    test("ab*c", "xxabbbc", 2, 5);
+    test("ab?", "xxa", 2, 1);
+    test("(?:ab)*c", "xxc", 2, 1);
+    test("(?:ab)+c", "xxababc", 2, 5);
+    test("x(?:ab)*c", "zxc", 1, 2);
+    test("ab|cd", "xxcd", 2, 2);
+    test("x(?:a|b)y", "xxby", 1, 3);
+    test("ab{0,2}c", "zac", 1, 2);
+    test("ab\\d", "ab ab1", 3, 3);
+    test("ab", "xAB", -1, 0);
+    test("ab", "xAB", 1, 2, std::regex_constants::icase);
+    test("ab*c", "xxac", 2, 2, std::regex_constants::basic);
+    test("ab*c", "xxac", 2, 2, std::regex_constants::extended);
+    test("ab|cd", "xxcd", 2, 2, std::regex_constants::extended);
+    test("ab\ncd", "xxcd", 2, 2, std::regex_constants::grep);
+    test("ab\ncd", "xxcd", 2, 2, std::regex_constants::egrep);
+    test("x(ab)*", "zx", 1, 1, std::regex_constants::extended | std::regex_constants::nosubs);
+    test("x(a|b)", "zxb", 1, 2, std::regex_constants::extended | std::regex_constants::nosubs);
+    test(L"ERROR: ([0-9]+)", L"INFO: 1\nERROR: 42", 8, 9);
+    test(L"ab*c", L"xxac", 2, 2);
+    {
+        // Copies and swaps keep the prefix with the pattern it belongs to.
+        std::regex r1("needle");
+        std::regex r2("a*b");
+        r1.swap(r2);
+        assert(std::regex_search("xxaab", r1));
+        assert(!std::regex_search("xxaab", r2));
+        assert(std::regex_search("xxneedle", r2));
+        std::regex r3 = r2;
+        assert(std::regex_search("hayneedle", r3));
+        r3.assign("c+");
+        assert(std::regex_search("xxc", r3));
+    }
+    {
+        std::regex re("ERROR");
+        const char text[] = "ERROR a ERROR b ERROR";
+        std::cregex_iterator it(text, text + sizeof(text) - 1, re), end;
+        int count = 0;
+        for (; it != end; ++it, ++count)
+            assert(it->position(0) == 8 * count);
+        assert(count == 3);
+    }
+}
@@ -0,0 +1,120 @@
+#!/usr/bin/env python
+#===----------------------------------------------------------------------===##
+#
+#                     The LLVM Compiler Infrastructure
+#
+# This file is dual licensed under the MIT and the University of Illinois Open
+# Source Licenses. See LICENSE.TXT for details.
+#
+#===----------------------------------------------------------------------===##
+
+"""Print the layer tables used by the ziggurat normal_distribution and
+exponential_distribution in <random>.
+
+The ziggurat covers f(x) = exp(-x*x/2), or f(x) = exp(-x), with n layers of
+equal area v.  Layer 0 is the rectangle [0, v / f(r)) x [0, f(r)) together
+with the tail beyond r.  Layer i, for 0 < i < n, spans [0, x[i]) x
+[f(x[i]), f(x[i+1])).  x[1] = r and x[n] = 0.  r is chosen so that the top
+layer has area v too.
+
+The tables are computed with 50 significant digits and printed with the 17
+digits that a double needs to round-trip.
+"""
+
+from decimal import Decimal, getcontext
+
+getcontext().prec = 50
+
+PI = Decimal('3.14159265358979323846264338327950288419716939937510')
+
+
+def erfc_scaled_tail(r):
+    """Integral of exp(-x*x/2) from r to infinity."""
+    # sqrt(pi/2) - integral from 0 to r, using the series for erf.
+    z = r / Decimal(2).sqrt()
+    term = z
+    total = z
+    n = 0
+    while True:
+        n += 1
+        term *= -z * z / n
+        add = term / (2 * n + 1)
+        total += add
+        if abs(add) < Decimal('1e-45'):
+            break
+    erf = 2 / PI.sqrt() * total
+    return (PI / 2).sqrt() * (1 - erf)
+
+
+class Normal(object):
+    layers = 128
+
+    @staticmethod
+    def f(x):
+        return (-x * x / 2).exp()
+
+    @staticmethod
+    def finv(y):
+        return (-2 * y.ln()).sqrt()
+
+    @staticmethod
+    def tail(r):
+        return erfc_scaled_tail(r)
+
+
+class Exponential(object):
+    layers = 256
+
+    @staticmethod
+    def f(x):
+        return (-x).exp()
+
+    @staticmethod
+    def finv(y):
+        return -y.ln()
+
+    @staticmethod
+    def tail(r):
+        return (-r).exp()
+
+
+def build(d, r):
+    """Returns (x, excess), where excess > 0 means r is too small."""
+    v = r * d.f(r) + d.tail(r)
+    x = [v / d.f(r), r]
+    for i in range(1, d.layers - 1):
+        y = v / x[i] + d.f(x[i])
+        if y >= 1:
+            return x, Decimal(1)
+        x.append(d.finv(y))
+    x.append(Decimal(0))
+    return x, v - x[-2] * (1 - d.f(x[-2]))
+
+
+def solve(d, lo, hi):
+    for _ in range(200):
+        mid = (lo + hi) / 2
+        _, excess = build(d, mid)
+        if excess > 0:
+            lo = mid
+        else:
+            hi = mid
+    return build(d, lo)[0]
+
+
+def emit(name, x):
+    print('    // %s' % name)
+    for i in range(0, len(x), 3):
+        row = ', '.join('%.16e' % float(v) for v in x[i:i + 3])
+        sep = ',' if i + 3 < len(x) else ''
+        print('    ' + row + sep)
+    print('')
+
+
+def main():
+    emit('normal', solve(Normal, Decimal(3), Decimal(4)))
+    emit('exponential', solve(Exponential, Decimal(7), Decimal(8)))
+
+
+if __name__ == '__main__':
+    main()